@@ -0,0 +1,135 @@
+#include "Algorithms.h"
+#include <iostream>
+#include <climits>
+#include <cstring>
+
+// Rejestr jako statyczna tablica wewnatrz funkcji - dostepny niezaleznie od
+// kolejnosci inicjalizacji obiektow rejestrujacych w roznych plikach
+static const int MAX_ALGORITHMS = 32;
+
+static int& registryCount() {
+    static int registered = 0;
+    return registered;
+}
+
+static AlgorithmInfo* registryTable() {
+    static AlgorithmInfo algorithms[MAX_ALGORITHMS];
+    return algorithms;
+}
+
+const char* representationName(int representation) {
+    switch(representation) {
+        case REP_MATRIX: return "macierzowa";
+        case REP_LIST: return "listowa";
+        case REP_TRIANGULAR: return "trojkatna";
+        default: return "?";
+    }
+}
+
+RunStatistics& lastRunStatistics() {
+    static thread_local RunStatistics statistics = {0};
+    return statistics;
+}
+
+// Wstawianie z zachowaniem kolejnosci (rodzaj grafu, nazwa), aby menu nie zalezalo
+// od kolejnosci laczenia plikow
+void registerAlgorithm(const AlgorithmInfo& info) {
+    AlgorithmInfo* algorithms = registryTable();
+    int& count = registryCount();
+    if(count >= MAX_ALGORITHMS) return;
+    
+    int position = count;
+    while(position > 0) {
+        const AlgorithmInfo& previous = algorithms[position - 1];
+        if(previous.kind < info.kind || (previous.kind == info.kind && strcmp(previous.name, info.name) < 0)) break;
+        algorithms[position] = previous;
+        position--;
+    }
+    algorithms[position] = info;
+    count++;
+}
+
+int algorithmCount() {
+    return registryCount();
+}
+
+const AlgorithmInfo& algorithmAt(int index) {
+    return registryTable()[index];
+}
+
+const AlgorithmInfo* findAlgorithm(const std::string& name) {
+    for(int i = 0; i < registryCount(); i++) {
+        if(name == registryTable()[i].name) return &registryTable()[i];
+    }
+    return nullptr;
+}
+
+bool acceptsGraph(const AlgorithmInfo& algorithm, const Graph& graph) {
+    bool needs_directed = (algorithm.kind != GRAPH_UNDIRECTED);
+    if(needs_directed != graph.isDirected()) {
+        std::cout << algorithm.title << " wymaga grafu " << (needs_directed ? "skierowanego" : "nieskierowanego")
+                  << "! Wczytaj lub wygeneruj odpowiedni graf." << std::endl;
+        return false;
+    }
+    if(graph.hasNegativeWeights() && algorithm.kind != GRAPH_DIRECTED_NEGATIVE) {
+        std::cout << algorithm.title << " nie obsluguje ujemnych wag!" << std::endl;
+        return false;
+    }
+    if(algorithm.shortest_paths && !graph.distancesFitInt()) {
+        std::cout << algorithm.title << ": odleglosci moga przekroczyc zakres int (najwieksza |waga| = "
+                  << graph.getMaxAbsWeight() << ", " << graph.getVertices() << " wierzcholkow)!" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+static void collectPath(const int* parent, int vertex, int* path, int& path_length) {
+    if(parent[vertex] == -1) {
+        path[path_length++] = vertex;
+        return;
+    }
+    
+    collectPath(parent, parent[vertex], path, path_length);
+    path[path_length++] = vertex;
+}
+
+void printShortestPaths(const Graph& graph, const int* dist, const int* parent) {
+    int vertices = graph.getVertices();
+    int start_vertex = graph.getStartVertex();
+    const int* original_id = graph.getOriginalId();
+    
+    std::cout << "Najkrotsze sciezki od wierzcholka " << original_id[start_vertex] << ":" << std::endl;
+    int* path = new int[vertices];
+    for(int i = 0; i < vertices; i++) {
+        if(i != start_vertex) {
+            std::cout << "Do wierzcholka " << original_id[i] << ": ";
+            if(dist[i] == INT_MAX) {
+                std::cout << "NIEOSIAGALNY" << std::endl;
+            } else {
+                std::cout << "koszt = " << dist[i] << ", sciezka: ";
+                int path_length = 0;
+                collectPath(parent, i, path, path_length);
+                
+                for(int j = 0; j < path_length; j++) {
+                    std::cout << original_id[path[j]];
+                    if(j < path_length - 1) std::cout << " -> ";
+                }
+                std::cout << std::endl;
+            }
+        }
+    }
+    delete[] path;
+}
+
+void printSpanningTree(const Graph& graph, const Edge* edges, int count) {
+    const int* original_id = graph.getOriginalId();
+    long long total_weight = 0;
+    
+    std::cout << "Krawedzie minimalnego drzewa rozpinajacego:" << std::endl;
+    for(int i = 0; i < count; i++) {
+        std::cout << original_id[edges[i].start] << " - " << original_id[edges[i].end]
+                  << " (waga: " << edges[i].weight << ")" << std::endl;
+        total_weight += edges[i].weight;
+    }
+    std::cout << "Sumaryczna waga MST: " << total_weight << std::endl;
+}
@@ -0,0 +1,106 @@
+#ifndef ALGORITHMS_H
+#define ALGORITHMS_H
+
+#include "Graph.h"
+#include "Verification.h"
+
+// Rejestr algorytmow: kazdy modul (Prim.cpp, Kruskal.cpp, Dijkstra.cpp, BellmanFord.cpp)
+// rejestruje sie statycznym obiektem AlgorithmRegistrar, a menu, testy wydajnosci
+// i weryfikacja korzystaja wylacznie z opisu AlgorithmInfo.
+
+enum Representation {
+    REP_MATRIX = 0,
+    REP_LIST = 1,
+    REP_TRIANGULAR = 2, // upakowany gorny trojkat macierzy (tylko grafy nieskierowane)
+    REP_COUNT
+};
+
+const int REP_MASK_ALL = (1 << REP_MATRIX) | (1 << REP_LIST);
+const int REP_MASK_LIST = 1 << REP_LIST;
+const int REP_MASK_UNDIRECTED = REP_MASK_ALL | (1 << REP_TRIANGULAR);
+
+const char* representationName(int representation);
+
+// Wynik algorytmu w postaci porownywalnej miedzy wariantami
+struct AlgorithmOutput {
+    long long weight;    // MST: suma wag drzewa
+    int* dist;           // najkrotsze sciezki: bufor V odleglosci dostarczony przez wywolujacego
+    int* parent;         // najkrotsze sciezki: opcjonalny bufor V poprzednikow w drzewie sciezek
+    bool negative_cycle; // najkrotsze sciezki: cykl ujemny osiagalny ze startu
+    Edge* tree;          // MST: opcjonalny bufor V krawedzi drzewa dostarczony przez wywolujacego
+    int tree_size;       // MST: liczba krawedzi zapisanych w tree
+    
+    AlgorithmOutput() : weight(0), dist(nullptr), parent(nullptr), negative_cycle(false), tree(nullptr), tree_size(0) {}
+};
+
+struct AlgorithmInfo {
+    const char* name;           // identyfikator, np. "prim"
+    const char* title;          // nazwa wyswietlana w menu
+    int kind;                   // GraphKind grafow, na ktorych algorytm jest testowany
+    bool shortest_paths;        // wynik: odleglosci ze startu (true) lub waga MST (false)
+    int representations;        // maska bitowa 1 << REP_*
+    const int* test_sizes;      // rozmiary grafow w testach wydajnosci
+    int num_sizes;
+    int num_tests;              // instancji na kazdy rozmiar i gestosc
+    
+    // Uruchomienie z pelnym wynikiem na ekranie
+    void (*run)(Graph& graph, int representation);
+    // Pomiar czasu jednego przebiegu; output != nullptr - wynik do weryfikacji (poza pomiarem)
+    double (*execute)(Graph& graph, int representation, AlgorithmOutput* output);
+    // Dodatkowe silniki porownywane z wynikiem referencyjnym (opcjonalnie)
+    void (*verify)(Graph& graph, VerificationContext& ctx, const AlgorithmOutput& reference);
+    // Opcje specyficzne dla algorytmu (opcjonalnie)
+    void (*menu)(Graph& graph);
+};
+
+// Statystyki ostatniego przebiegu execute w biezacym watku (watki pomiarowe testow
+// wydajnosci mierza instancje niezaleznie); rounds == 0 - algorytm ich nie podaje
+struct RunStatistics {
+    int rounds; // rundy relaksacji (Bellman-Ford)
+};
+
+RunStatistics& lastRunStatistics();
+
+void registerAlgorithm(const AlgorithmInfo& info);
+int algorithmCount();
+const AlgorithmInfo& algorithmAt(int index);
+const AlgorithmInfo* findAlgorithm(const std::string& name);
+
+// Czy algorytm moze dzialac na danym grafie (skierowanie i znak wag); w przeciwnym
+// razie wypisuje powod i zwraca false
+bool acceptsGraph(const AlgorithmInfo& algorithm, const Graph& graph);
+
+class AlgorithmRegistrar {
+public:
+    AlgorithmRegistrar(const AlgorithmInfo& info) {
+        registerAlgorithm(info);
+    }
+};
+
+// Wyniki zapytan wsadowych algorytmow najkrotszych sciezek
+struct BatchResult {
+    int num_sources;
+    int row_length;       // liczba wierzcholkow (tryb pelny) lub liczba celow
+    int* dist;            // num_sources * row_length
+    int* parent;          // num_sources * row_length, nullptr gdy zwracamy tylko odleglosci do celow
+    bool* negative_cycle; // cykl ujemny osiagalny z danego zrodla
+    
+    BatchResult(int sources, int length, bool with_parent) : num_sources(sources), row_length(length) {
+        dist = new int[(size_t)sources * length];
+        parent = with_parent ? new int[(size_t)sources * length] : nullptr;
+        negative_cycle = new bool[sources];
+        for(int i = 0; i < sources; i++) negative_cycle[i] = false;
+    }
+    
+    ~BatchResult() {
+        delete[] dist;
+        delete[] parent;
+        delete[] negative_cycle;
+    }
+};
+
+// Wypisanie wynikow w numeracji wejsciowej grafu
+void printShortestPaths(const Graph& graph, const int* dist, const int* parent);
+void printSpanningTree(const Graph& graph, const Edge* edges, int count);
+
+#endif
@@ -0,0 +1,111 @@
+#include "Baseline.h"
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+
+Baseline::Baseline() : entries(nullptr), entry_count(0), capacity(0), seed(0), has_seed(false) {}
+
+Baseline::~Baseline() {
+    for(int i = 0; i < entry_count; i++) {
+        delete[] entries[i].times;
+    }
+    delete[] entries;
+}
+
+void Baseline::grow() {
+    int new_capacity = capacity == 0 ? 64 : capacity * 2;
+    BaselineEntry* new_entries = new BaselineEntry[new_capacity];
+    for(int i = 0; i < entry_count; i++) {
+        new_entries[i] = entries[i];
+    }
+    delete[] entries;
+    entries = new_entries;
+    capacity = new_capacity;
+}
+
+void Baseline::add(const std::string& algorithm, int representation, int vertices, int density, const double* times, int count) {
+    if(entry_count == capacity) grow();
+    BaselineEntry& entry = entries[entry_count++];
+    entry.algorithm = algorithm;
+    entry.representation = representation;
+    entry.vertices = vertices;
+    entry.density = density;
+    entry.count = count;
+    entry.times = new double[count > 0 ? count : 1];
+    for(int i = 0; i < count; i++) {
+        entry.times[i] = times[i];
+    }
+}
+
+const BaselineEntry* Baseline::find(const std::string& algorithm, int representation, int vertices, int density) const {
+    for(int i = 0; i < entry_count; i++) {
+        const BaselineEntry& entry = entries[i];
+        if(entry.representation == representation && entry.vertices == vertices &&
+           entry.density == density && entry.algorithm == algorithm) {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+bool Baseline::load(const std::string& filename) {
+    std::ifstream file(filename);
+    if(!file.is_open()) {
+        std::cout << "Blad: Nie mozna otworzyc pliku " << filename << std::endl;
+        return false;
+    }
+    
+    std::string line;
+    int line_number = 0;
+    while(std::getline(file, line)) {
+        line_number++;
+        if(line.compare(0, 8, "# ziarno") == 0) {
+            std::istringstream stream(line.substr(8));
+            if(stream >> seed) has_seed = true;
+            continue;
+        }
+        if(line.empty() || line[0] == '#') continue;
+        
+        std::istringstream stream(line);
+        std::string algorithm;
+        int representation, vertices, density, count;
+        if(!(stream >> algorithm >> representation >> vertices >> density >> count) || count <= 0) {
+            std::cout << "Blad: Nieprawidlowa linia " << line_number << " pliku " << filename << std::endl;
+            return false;
+        }
+        double* times = new double[count];
+        int read = 0;
+        while(read < count && stream >> times[read]) read++;
+        if(read < count) {
+            std::cout << "Blad: Nieprawidlowa linia " << line_number << " pliku " << filename << std::endl;
+            delete[] times;
+            return false;
+        }
+        add(algorithm, representation, vertices, density, times, count);
+        delete[] times;
+    }
+    return true;
+}
+
+bool Baseline::save(const std::string& filename) const {
+    std::ofstream file(filename);
+    if(!file.is_open()) {
+        std::cout << "Blad: Nie mozna utworzyc pliku " << filename << std::endl;
+        return false;
+    }
+    
+    file << "# wzorzec testow wydajnosci: algorytm reprezentacja wierzcholki gestosc liczba_czasow czasy[s]" << std::endl;
+    if(has_seed) file << "# ziarno " << seed << std::endl;
+    file << std::setprecision(9);
+    for(int i = 0; i < entry_count; i++) {
+        const BaselineEntry& entry = entries[i];
+        file << entry.algorithm << " " << entry.representation << " " << entry.vertices << " "
+             << entry.density << " " << entry.count;
+        for(int t = 0; t < entry.count; t++) {
+            file << " " << entry.times[t];
+        }
+        file << std::endl;
+    }
+    return true;
+}
@@ -0,0 +1,50 @@
+#ifndef BASELINE_H
+#define BASELINE_H
+
+#include <string>
+
+// Wzorzec wynikow testow wydajnosci: czasy wszystkich instancji kazdego zestawu
+// (algorytm, reprezentacja, rozmiar, gestosc), aby pozniejszy przebieg mozna bylo
+// porownac z nim testem statystycznym, a nie tylko srednia.
+//
+// Format pliku tekstowego (pozostale linie zaczynajace sie od # to komentarze):
+//   # ziarno <ziarno bazowe instancji>
+//   <algorytm> <reprezentacja> <wierzcholki> <gestosc> <liczba czasow> <czas>...
+
+struct BaselineEntry {
+    std::string algorithm;
+    int representation;
+    int vertices;
+    int density;
+    int count;
+    double* times;
+};
+
+class Baseline {
+private:
+    BaselineEntry* entries;
+    int entry_count;
+    int capacity;
+    unsigned int seed;
+    bool has_seed;
+    
+    void grow();
+    
+public:
+    Baseline();
+    ~Baseline();
+    
+    bool load(const std::string& filename);
+    bool save(const std::string& filename) const;
+    void add(const std::string& algorithm, int representation, int vertices, int density, const double* times, int count);
+    const BaselineEntry* find(const std::string& algorithm, int representation, int vertices, int density) const;
+    int size() const { return entry_count; }
+    const BaselineEntry& at(int index) const { return entries[index]; }
+    
+    // Ziarno bazowe instancji wzorca - porownanie moze zmierzyc te same grafy
+    bool hasSeed() const { return has_seed; }
+    unsigned int getSeed() const { return seed; }
+    void setSeed(unsigned int value) { seed = value; has_seed = true; }
+};
+
+#endif
@@ -2,323 +2,298 @@
 #include <fstream>
 #include <string>
 #include <cstdlib>
-#include <ctime>
 #include <chrono>
 #include <iomanip>
 #include <climits>
+#include <limits>
+#include "Algorithms.h"
+#include "MinHeap.h"
+#include "DynamicSSSP.h"
+#include "Parallel.h"
 
-struct Edge {
-    int start, end, weight;
-    
-    Edge() : start(0), end(0), weight(0) {}
-    Edge(int s, int e, int w) : start(s), end(e), weight(w) {}
-};
-
-class Graph {
+// Silnik Bellmana-Forda na wspolnym grafie: wskazniki do reprezentacji pobierane
+// z grafu przy tworzeniu silnika (silnik nie zmienia grafu).
+class BellmanFordSolver {
 private:
+    Graph& graph;
     int vertices;
-    int edges_count;
     int start_vertex;
-    int** adjacency_matrix;
-    Edge* edge_list;
     int** adjacency_list;
     int* list_sizes;
-    
-    void reallocateMemory(int new_vertices) {
-        if(adjacency_matrix) {
-            for(int i = 0; i < vertices; i++) {
-                delete[] adjacency_matrix[i];
-                delete[] adjacency_list[i];
-            }
-            delete[] adjacency_matrix;
-            delete[] adjacency_list;
-            delete[] list_sizes;
-            delete[] edge_list;
-        }
-        
-        vertices = new_vertices;
-        adjacency_matrix = new int*[vertices];
-        for(int i = 0; i < vertices; i++) {
-            adjacency_matrix[i] = new int[vertices];
-            for(int j = 0; j < vertices; j++) {
-                adjacency_matrix[i][j] = 0;
-            }
-        }
-        
-        adjacency_list = new int*[vertices];
-        list_sizes = new int[vertices];
-        for(int i = 0; i < vertices; i++) {
-            adjacency_list[i] = new int[vertices * 2]; // [sasiad, waga, sasiad, waga, ...]
-            list_sizes[i] = 0;
-        }
-        
-        edge_list = new Edge[vertices * vertices];
-        edges_count = 0;
-    }
+    const int* original_id;
+    const int* current_id;
     
 public:
-    Graph(int v) : vertices(v), edges_count(0), start_vertex(0), adjacency_matrix(nullptr), 
-                   edge_list(nullptr), adjacency_list(nullptr), list_sizes(nullptr) {
-        reallocateMemory(v);
-    }
-    
-    ~Graph() {
-        if(adjacency_matrix) {
-            for(int i = 0; i < vertices; i++) {
-                delete[] adjacency_matrix[i];
-                delete[] adjacency_list[i];
-            }
-            delete[] adjacency_matrix;
-            delete[] adjacency_list;
-            delete[] list_sizes;
-            delete[] edge_list;
-        }
-    }
+    BellmanFordSolver(Graph& g) : graph(g), vertices(g.getVertices()), start_vertex(g.getStartVertex()),
+                                  adjacency_list(g.getList()),
+                                  list_sizes(g.getListSizes()), original_id(g.getOriginalId()),
+                                  current_id(g.getCurrentId()) {}
     
-    void loadFromFile(const std::string& filename) {
-        std::ifstream file(filename);
-        if(!file.is_open()) {
-            std::cout << "Blad: Nie mozna otworzyc pliku " << filename << std::endl;
-            return;
-        }
-        
-        int file_edges, file_vertices;
-        file >> file_edges >> file_vertices >> start_vertex;
-        
-        reallocateMemory(file_vertices);
-        
-        for(int i = 0; i < file_edges; i++) {
-            int start, end, weight;
-            file >> start >> end >> weight;
-            addEdge(start, end, weight);
-            edge_list[i] = Edge(start, end, weight);
-        }
-        edges_count = file_edges;
-        
-        file.close();
-        
-        std::cout << "Graf wczytany z pliku (wierzcholek startowy: " << start_vertex << "). Reprezentacje:" << std::endl;
-        displayMatrix();
-        displayList();
-    }
-    
-    void generateRandom(int v, int density) {
-        reallocateMemory(v);
-        start_vertex = 0; // Domyslny wierzcholek startowy
-        
-        // Generowanie cyklu dla spojnosci (graf skierowany z ujemnymi wagami)
+    // Klasyczny Bellman-Ford: (V-1) pelnych rund relaksacji po zwartej macierzy wag typu W
+    // lub po liscie, z odleglosciami typu D. Zwraca liczbe rund.
+    template<typename W, typename D>
+    int bellmanFordKernel(int representation, const W* adjacency_matrix, D* dist, int* parent) {
+        const D infinity = std::numeric_limits<D>::max();
+        const AdjacencyBitmap* bits = representation == REP_MATRIX ? &graph.getAdjacencyBitmap() : nullptr;
         for(int i = 0; i < vertices; i++) {
-            int next = (i + 1) % vertices;
-            int weight = (rand() % 200) - 100; // Wagi od -100 do 99
-            addEdge(i, next, weight);
-            edge_list[edges_count++] = Edge(i, next, weight);
+            dist[i] = infinity;
+            parent[i] = -1;
         }
+        dist[start_vertex] = 0;
         
-        int max_edges = vertices * (vertices - 1); // Graf skierowany
-        int target_edges = (max_edges * density) / 100;
-        
-        while(edges_count < target_edges) {
-            int start = rand() % vertices;
-            int end = rand() % vertices;
-            
-            if(start != end && adjacency_matrix[start][end] == 0) {
-                int weight = (rand() % 200) - 100; // Wagi od -100 do 99
-                addEdge(start, end, weight);
-                edge_list[edges_count++] = Edge(start, end, weight);
+        // Relaksacja krawedzi (V-1) razy
+        for(int i = 0; i < vertices - 1; i++) {
+            for(int u = 0; u < vertices; u++) {
+                if(dist[u] == infinity) continue;
+                if(representation == REP_MATRIX) {
+                    // Sasiedzi wg mapy bitowej - puste slowa pomijane bez czytania wag
+                    const W* row = adjacency_matrix + (size_t)u * vertices;
+                    const uint64_t* row_bits = bits->row(u);
+                    for(int word = 0; word < bits->rowWords(); word++) {
+                        for(uint64_t mask = row_bits[word]; mask; mask &= mask - 1) {
+                            int v = word * 64 + lowestBit(mask);
+                            if(dist[u] + row[v] < dist[v]) {
+                                dist[v] = dist[u] + row[v];
+                                parent[v] = u;
+                            }
+                        }
+                    }
+                } else {
+                    for(int j = 0; j < list_sizes[u]; j++) {
+                        int v = adjacency_list[u][j * 2];
+                        int weight = adjacency_list[u][j * 2 + 1];
+                        
+                        if(dist[u] + weight < dist[v]) {
+                            dist[v] = dist[u] + weight;
+                            parent[v] = u;
+                        }
+                    }
+                }
             }
         }
-        
-        std::cout << "Graf wygenerowany losowo (" << vertices << " wierzcholkow, " 
-                  << density << "% gestosci, " << edges_count << " krawedzi, start: " << start_vertex << ")" << std::endl;
-        displayMatrix();
-        displayList();
+        return vertices > 1 ? vertices - 1 : 0;
     }
     
-    void generateRandomForTesting(int v, int density) {
-        reallocateMemory(v);
-        start_vertex = 0;
-        
-        // Generowanie cyklu dla spojnosci
+    // Wariant Yena: krawedzie podzielone wg numeracji na "w przod" (u < v) i "wstecz" (u > v).
+    // Runda przechodzi wierzcholki rosnaco po krawedziach w przod, a potem malejaco po krawedziach
+    // wstecz, wiec przenosi odleglosci wzdluz calych monotonicznych odcinkow sciezki. Sciezka prosta
+    // ma najwyzej V-1 odcinkow na przemian rosnacych i malejacych, stad V/2 + 1 rund zamiast V-1;
+    // petla konczy sie wczesniej, gdy runda nie poprawi zadnej odleglosci. Zwraca liczbe rund.
+    template<typename W, typename D>
+    int yenKernel(int representation, const W* adjacency_matrix, D* dist, int* parent) {
+        const D infinity = std::numeric_limits<D>::max();
         for(int i = 0; i < vertices; i++) {
-            int next = (i + 1) % vertices;
-            int weight = (rand() % 200) - 100; // Wagi od -100 do 99
-            addEdge(i, next, weight);
-            edge_list[edges_count++] = Edge(i, next, weight);
+            dist[i] = infinity;
+            parent[i] = -1;
         }
+        dist[start_vertex] = 0;
         
-        int max_edges = vertices * (vertices - 1);
-        int target_edges = (max_edges * density) / 100;
+        // Lista: wiersze przepisane tak, ze krawedzie w przod poprzedzaja krawedzie wstecz,
+        // wiersz u to [offsets[u], split[u]) w przod i [split[u], offsets[u + 1]) wstecz
+        int* offsets = nullptr;
+        int* split = nullptr;
+        int* targets = nullptr;
+        int* weights = nullptr;
+        if(representation != REP_MATRIX) {
+            offsets = new int[vertices + 1];
+            split = new int[vertices];
+            offsets[0] = 0;
+            for(int u = 0; u < vertices; u++) offsets[u + 1] = offsets[u] + list_sizes[u];
+            targets = new int[offsets[vertices]];
+            weights = new int[offsets[vertices]];
+            for(int u = 0; u < vertices; u++) {
+                int forward = offsets[u];
+                int backward = offsets[u + 1];
+                for(int j = 0; j < list_sizes[u]; j++) {
+                    int v = adjacency_list[u][j * 2];
+                    int position = v > u ? forward++ : --backward;
+                    targets[position] = v;
+                    weights[position] = adjacency_list[u][j * 2 + 1];
+                }
+                split[u] = forward;
+            }
+        }
+        const AdjacencyBitmap* bits = representation == REP_MATRIX ? &graph.getAdjacencyBitmap() : nullptr;
+        
+        bool changed = false;
+        auto relax = [&](int u, int v, D weight) {
+            if(dist[u] + weight < dist[v]) {
+                dist[v] = dist[u] + weight;
+                parent[v] = u;
+                changed = true;
+            }
+        };
         
-        while(edges_count < target_edges) {
-            int start = rand() % vertices;
-            int end = rand() % vertices;
-            
-            if(start != end && adjacency_matrix[start][end] == 0) {
-                int weight = (rand() % 200) - 100; // Wagi od -100 do 99
-                addEdge(start, end, weight);
-                edge_list[edges_count++] = Edge(start, end, weight);
+        int max_rounds = vertices / 2 + 1;
+        int rounds = 0;
+        while(rounds < max_rounds) {
+            rounds++;
+            changed = false;
+            for(int u = 0; u < vertices; u++) {
+                if(dist[u] == infinity) continue;
+                if(representation == REP_MATRIX) {
+                    // Slowa mapy bitowej od kolumny u + 1 (w pierwszym slowie bity do u wyzerowane)
+                    const W* row = adjacency_matrix + (size_t)u * vertices;
+                    const uint64_t* row_bits = bits->row(u);
+                    uint64_t first_mask = (~0ULL << (u & 63)) << 1;
+                    for(int word = u >> 6; word < bits->rowWords(); word++, first_mask = ~0ULL) {
+                        for(uint64_t mask = row_bits[word] & first_mask; mask; mask &= mask - 1) {
+                            int v = word * 64 + lowestBit(mask);
+                            relax(u, v, row[v]);
+                        }
+                    }
+                } else {
+                    for(int e = offsets[u]; e < split[u]; e++) relax(u, targets[e], weights[e]);
+                }
             }
+            for(int u = vertices - 1; u >= 0; u--) {
+                if(dist[u] == infinity) continue;
+                if(representation == REP_MATRIX) {
+                    // Slowa mapy bitowej do kolumny u - 1 (w ostatnim slowie bity od u wyzerowane)
+                    const W* row = adjacency_matrix + (size_t)u * vertices;
+                    const uint64_t* row_bits = bits->row(u);
+                    int last_word = u >> 6;
+                    for(int word = 0; word <= last_word; word++) {
+                        uint64_t mask = row_bits[word];
+                        if(word == last_word) mask &= (1ULL << (u & 63)) - 1;
+                        for(; mask; mask &= mask - 1) {
+                            int v = word * 64 + lowestBit(mask);
+                            relax(u, v, row[v]);
+                        }
+                    }
+                } else {
+                    for(int e = split[u]; e < offsets[u + 1]; e++) relax(u, targets[e], weights[e]);
+                }
+            }
+            if(!changed) break;
         }
+        
+        delete[] offsets;
+        delete[] split;
+        delete[] targets;
+        delete[] weights;
+        return rounds;
     }
     
-    void addEdge(int start, int end, int weight) {
-        // Graf skierowany - tylko jedna krawedz
-        adjacency_matrix[start][end] = weight;
-        
-        // Lista sasiedztwa: [sasiad, waga, sasiad, waga, ...]
-        adjacency_list[start][list_sizes[start] * 2] = end;
-        adjacency_list[start][list_sizes[start] * 2 + 1] = weight;
-        list_sizes[start]++;
+    // Wybor instancji wg najwezszego typu wag grafu (macierz zbudowana przed pomiarem)
+    template<typename W, typename D>
+    int runKernel(bool yen, int representation, const W* adjacency_matrix, D* dist, int* parent) {
+        if(yen) return yenKernel(representation, adjacency_matrix, dist, parent);
+        return bellmanFordKernel(representation, adjacency_matrix, dist, parent);
     }
     
-    void displayMatrix() {
-        if(vertices > 20) {
-            std::cout << "\nGraf zbyt duzy do wyswietlenia macierzy (>20 wierzcholkow)" << std::endl;
-            return;
-        }
-        
-        std::cout << "\nReprezentacja macierzowa (graf skierowany z ujemnymi wagami):" << std::endl;
-        std::cout << "   ";
-        for(int i = 0; i < vertices; i++) {
-            std::cout << i << "  ";
-        }
-        std::cout << std::endl;
-        
-        for(int i = 0; i < vertices; i++) {
-            std::cout << i << ": ";
-            for(int j = 0; j < vertices; j++) {
-                std::cout << adjacency_matrix[i][j] << "  ";
-            }
-            std::cout << std::endl;
+    template<typename D>
+    int bellmanFordDispatch(bool yen, int representation, D* dist, int* parent) {
+        if(representation != REP_MATRIX) return runKernel<int32_t, D>(yen, representation, nullptr, dist, parent);
+        switch(graph.getWeightWidth()) {
+            case WEIGHT_INT8: return runKernel(yen, representation, graph.getNarrowMatrix<int8_t>(), dist, parent);
+            case WEIGHT_INT16: return runKernel(yen, representation, graph.getNarrowMatrix<int16_t>(), dist, parent);
+            default: return runKernel(yen, representation, graph.getNarrowMatrix<int32_t>(), dist, parent);
         }
     }
     
-    void displayList() {
-        if(vertices > 20) {
-            std::cout << "\nGraf zbyt duzy do wyswietlenia listy (>20 wierzcholkow)" << std::endl;
-            return;
-        }
-        
-        std::cout << "\nReprezentacja listowa (graf skierowany z ujemnymi wagami):" << std::endl;
-        for(int i = 0; i < vertices; i++) {
-            std::cout << i << ": ";
-            for(int j = 0; j < list_sizes[i]; j++) {
-                int neighbor = adjacency_list[i][j * 2];
-                int weight = adjacency_list[i][j * 2 + 1];
-                std::cout << "(" << neighbor << "," << weight << ") ";
-            }
-            std::cout << std::endl;
-        }
+    // Czy suma wag relaksowanego spaceru moze wyjsc poza int. Bez wag ujemnych relaksacja
+    // poprawia tylko sciezki proste (najwyzej V-1 krawedzi); z wagami ujemnymi cykl ujemny
+    // w (V-1) rundach wydluza spacer do (V-1)^2 krawedzi. Runda Yena to dwa przejscia,
+    // kazde o najwyzej V-1 krawedzi, w V/2 + 1 rundach.
+    bool needsWideDistances(bool yen) const {
+        long long walk_edges = vertices - 1;
+        if(graph.hasNegativeWeights()) walk_edges *= yen ? 2LL * (vertices / 2 + 1) : vertices - 1;
+        return (long long)graph.getMaxAbsWeight() * walk_edges >= INT_MAX;
     }
     
-    void printPath(int parent[], int vertex, int* path, int& path_length) {
-        if(parent[vertex] == -1) {
-            path[path_length++] = vertex;
-            return;
-        }
-        
-        printPath(parent, parent[vertex], path, path_length);
-        path[path_length++] = vertex;
+    // Odleglosci ze startu klasycznym algorytmem lub wariantem Yena (yen); zwraca liczbe rund
+    int bellmanFordArray(bool yen, int representation, int* dist, int* parent) {
+        if(!needsWideDistances(yen)) return bellmanFordDispatch(yen, representation, dist, parent);
+        
+        // Odleglosci 64-bitowe; wartosci spoza int powstaja tylko przy cyklu ujemnym,
+        // wiec sa nasycane (hasNegativeCycle liczy w long long i nadal go wykryje)
+        long long* wide_dist = new long long[vertices];
+        int rounds = bellmanFordDispatch(yen, representation, wide_dist, parent);
+        narrowDistances(wide_dist, dist);
+        delete[] wide_dist;
+        return rounds;
     }
     
-    void bellmanFordMatrix() {
-        std::cout << "\nAlgorytm Bellmana-Forda - reprezentacja macierzowa:" << std::endl;
-        std::cout << "Wierzcholek startowy: " << start_vertex << std::endl;
-        
-        auto start_time = std::chrono::high_resolution_clock::now();
-        
-        int* dist = new int[vertices];
-        int* parent = new int[vertices];
-        
-        // Inicjalizacja
+    // Przepisanie odleglosci 64-bitowych do int z nasyceniem (LLONG_MAX -> INT_MAX, brak sciezki)
+    void narrowDistances(const long long* wide_dist, int* dist) const {
         for(int i = 0; i < vertices; i++) {
-            dist[i] = INT_MAX;
-            parent[i] = -1;
+            if(wide_dist[i] == LLONG_MAX) dist[i] = INT_MAX;
+            else if(wide_dist[i] >= INT_MAX) dist[i] = INT_MAX - 1;
+            else if(wide_dist[i] < INT_MIN) dist[i] = INT_MIN;
+            else dist[i] = (int)wide_dist[i];
         }
-        dist[start_vertex] = 0;
-        
-        // Relaksacja krawedzi (V-1) razy
-        for(int i = 0; i < vertices - 1; i++) {
-            for(int u = 0; u < vertices; u++) {
-                for(int v = 0; v < vertices; v++) {
-                    if(adjacency_matrix[u][v] != 0 && dist[u] != INT_MAX && 
-                       dist[u] + adjacency_matrix[u][v] < dist[v]) {
-                        dist[v] = dist[u] + adjacency_matrix[u][v];
-                        parent[v] = u;
-                    }
-                }
-            }
-        }
-        
-        // Sprawdzenie cykli ujemnych
-        bool has_negative_cycle = false;
+    }
+    
+    // Dodatkowa runda relaksacji: poprawa ktorejkolwiek odleglosci oznacza cykl ujemny
+    // (sumy w long long - odleglosci nasycone przez bellmanFordArray nie przepelniaja sie)
+    template<typename W>
+    bool negativeCycleKernel(int representation, const W* adjacency_matrix, const int* dist) {
         for(int u = 0; u < vertices; u++) {
-            for(int v = 0; v < vertices; v++) {
-                if(adjacency_matrix[u][v] != 0 && dist[u] != INT_MAX && 
-                   dist[u] + adjacency_matrix[u][v] < dist[v]) {
-                    has_negative_cycle = true;
-                    break;
+            if(dist[u] == INT_MAX) continue;
+            if(representation == REP_MATRIX) {
+                const W* row = adjacency_matrix + (size_t)u * vertices;
+                const uint64_t* row_bits = graph.getAdjacencyBitmap().row(u);
+                for(int word = 0; word < graph.getAdjacencyBitmap().rowWords(); word++) {
+                    for(uint64_t mask = row_bits[word]; mask; mask &= mask - 1) {
+                        int v = word * 64 + lowestBit(mask);
+                        if((long long)dist[u] + row[v] < dist[v]) return true;
+                    }
                 }
-            }
-            if(has_negative_cycle) break;
-        }
-        
-        auto end_time = std::chrono::high_resolution_clock::now();
-        auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(end_time - start_time);
-        double seconds = duration.count() / 1000000000.0;
-        
-        if(has_negative_cycle) {
-            std::cout << "WYKRYTO CYKL UJEMNY W GRAFIE!" << std::endl;
-        } else {
-            std::cout << "Najkrotsze sciezki od wierzcholka " << start_vertex << ":" << std::endl;
-            for(int i = 0; i < vertices; i++) {
-                if(i != start_vertex) {
-                    std::cout << "Do wierzcholka " << i << ": ";
-                    if(dist[i] == INT_MAX) {
-                        std::cout << "NIEOSIAGALNY" << std::endl;
-                    } else {
-                        std::cout << "koszt = " << dist[i] << ", sciezka: ";
-                        int* path = new int[vertices];
-                        int path_length = 0;
-                        printPath(parent, i, path, path_length);
-                        
-                        for(int j = 0; j < path_length; j++) {
-                            std::cout << path[j];
-                            if(j < path_length - 1) std::cout << " -> ";
-                        }
-                        std::cout << std::endl;
-                        delete[] path;
+            } else {
+                for(int j = 0; j < list_sizes[u]; j++) {
+                    if((long long)dist[u] + adjacency_list[u][j * 2 + 1] < dist[adjacency_list[u][j * 2]]) {
+                        return true;
                     }
                 }
             }
         }
-        
-        std::cout << "Czas wykonania (reprezentacja macierzowa): " << std::fixed << std::setprecision(6) << seconds << " sekund" << std::endl;
-        
-        delete[] dist;
-        delete[] parent;
+        return false;
     }
     
-    void bellmanFordList() {
-        std::cout << "\nAlgorytm Bellmana-Forda - reprezentacja listowa:" << std::endl;
-        std::cout << "Wierzcholek startowy: " << start_vertex << std::endl;
-        
-        auto start_time = std::chrono::high_resolution_clock::now();
-        
-        int* dist = new int[vertices];
-        int* parent = new int[vertices];
-        
-        // Inicjalizacja
+    bool hasNegativeCycle(int representation, const int* dist) {
+        if(representation != REP_MATRIX) return negativeCycleKernel<int32_t>(representation, nullptr, dist);
+        switch(graph.getWeightWidth()) {
+            case WEIGHT_INT8: return negativeCycleKernel(representation, graph.getNarrowMatrix<int8_t>(), dist);
+            case WEIGHT_INT16: return negativeCycleKernel(representation, graph.getNarrowMatrix<int16_t>(), dist);
+            default: return negativeCycleKernel(representation, graph.getNarrowMatrix<int32_t>(), dist);
+        }
+    }
+    
+    // Bellman-Ford na liscie sasiedztwa dla zapytan wsadowych: zapisuje wynik
+    // w buforach wywolujacego i konczy petle, gdy runda nie poprawila zadnej odleglosci.
+    // Zwraca true, gdy z source osiagalny jest cykl ujemny.
+    bool bellmanFordFromSource(int source, int* dist, int* parent) {
         for(int i = 0; i < vertices; i++) {
             dist[i] = INT_MAX;
             parent[i] = -1;
         }
-        dist[start_vertex] = 0;
+        dist[source] = 0;
         
-        // Relaksacja krawedzi (V-1) razy
+        return relaxUntilStable(dist, parent);
+    }
+    
+    // Rdzen Bellmana-Forda: (V-1) rund relaksacji od zainicjalizowanych dist/parent
+    // z wczesnym zakonczeniem, a nastepnie sprawdzenie cyklu ujemnego. Gdy cykl ujemny
+    // moze wyprowadzic spacer poza int, relaksacja idzie w long long (jak bellmanFordArray).
+    bool relaxUntilStable(int* dist, int* parent) {
+        if(!needsWideDistances(false)) return relaxKernel(dist, parent);
+        
+        long long* wide_dist = new long long[vertices];
+        for(int i = 0; i < vertices; i++) wide_dist[i] = dist[i] == INT_MAX ? LLONG_MAX : dist[i];
+        bool negative_cycle = relaxKernel(wide_dist, parent);
+        narrowDistances(wide_dist, dist);
+        delete[] wide_dist;
+        return negative_cycle;
+    }
+    
+    template<typename D>
+    bool relaxKernel(D* dist, int* parent) {
+        const D infinity = std::numeric_limits<D>::max();
         for(int i = 0; i < vertices - 1; i++) {
+            bool changed = false;
             for(int u = 0; u < vertices; u++) {
-                if(dist[u] != INT_MAX) {
+                if(dist[u] != infinity) {
                     for(int j = 0; j < list_sizes[u]; j++) {
                         int v = adjacency_list[u][j * 2];
                         int weight = adjacency_list[u][j * 2 + 1];
@@ -326,279 +301,615 @@ public:
                         if(dist[u] + weight < dist[v]) {
                             dist[v] = dist[u] + weight;
                             parent[v] = u;
+                            changed = true;
                         }
                     }
                 }
             }
+            if(!changed) return false;
         }
         
-        // Sprawdzenie cykli ujemnych
-        bool has_negative_cycle = false;
         for(int u = 0; u < vertices; u++) {
-            if(dist[u] != INT_MAX) {
+            if(dist[u] != infinity) {
                 for(int j = 0; j < list_sizes[u]; j++) {
                     int v = adjacency_list[u][j * 2];
                     int weight = adjacency_list[u][j * 2 + 1];
                     
                     if(dist[u] + weight < dist[v]) {
-                        has_negative_cycle = true;
-                        break;
+                        return true;
                     }
                 }
-                if(has_negative_cycle) break;
             }
         }
+        return false;
+    }
+    
+    // Zapytania wsadowe: Bellman-Ford z wielu zrodel liczony rownolegle na wspoldzielonym grafie.
+    // targets == nullptr -> pelne tablice dist/parent dla kazdego zrodla,
+    // w przeciwnym razie tylko odleglosci do podanych celow (bez tablicy parent).
+    BatchResult* batchBellmanFord(const int* sources, int num_sources, const int* targets, int num_targets, int num_threads) {
+        bool full = (targets == nullptr);
+        BatchResult* result = new BatchResult(num_sources, full ? vertices : num_targets, full);
+        
+        if(num_threads < 1) num_threads = defaultThreadCount();
+        if(num_threads > num_sources) num_threads = num_sources > 0 ? num_sources : 1;
+        
+        // Bufory robocze kazdego watku - potrzebne tylko, gdy zwracamy same cele
+        int** scratch_dist = new int*[num_threads];
+        int** scratch_parent = new int*[num_threads];
+        for(int t = 0; t < num_threads; t++) {
+            scratch_dist[t] = full ? nullptr : new int[vertices];
+            scratch_parent[t] = full ? nullptr : new int[vertices];
+        }
         
-        auto end_time = std::chrono::high_resolution_clock::now();
-        auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(end_time - start_time);
-        double seconds = duration.count() / 1000000000.0;
-        
-        if(has_negative_cycle) {
-            std::cout << "WYKRYTO CYKL UJEMNY W GRAFIE!" << std::endl;
-        } else {
-            std::cout << "Najkrotsze sciezki od wierzcholka " << start_vertex << ":" << std::endl;
-            for(int i = 0; i < vertices; i++) {
-                if(i != start_vertex) {
-                    std::cout << "Do wierzcholka " << i << ": ";
-                    if(dist[i] == INT_MAX) {
-                        std::cout << "NIEOSIAGALNY" << std::endl;
-                    } else {
-                        std::cout << "koszt = " << dist[i] << ", sciezka: ";
-                        int* path = new int[vertices];
-                        int path_length = 0;
-                        printPath(parent, i, path, path_length);
-                        
-                        for(int j = 0; j < path_length; j++) {
-                            std::cout << path[j];
-                            if(j < path_length - 1) std::cout << " -> ";
-                        }
-                        std::cout << std::endl;
-                        delete[] path;
-                    }
+        parallelFor(num_sources, num_threads, [&](int query, int t) {
+            if(full) {
+                int* dist = result->dist + (long long)query * vertices;
+                int* parent = result->parent + (long long)query * vertices;
+                result->negative_cycle[query] = bellmanFordFromSource(sources[query], dist, parent);
+            } else {
+                result->negative_cycle[query] = bellmanFordFromSource(sources[query], scratch_dist[t], scratch_parent[t]);
+                int* row = result->dist + (long long)query * num_targets;
+                for(int i = 0; i < num_targets; i++) {
+                    row[i] = scratch_dist[t][targets[i]];
                 }
             }
-        }
+        });
         
-        std::cout << "Czas wykonania (reprezentacja listowa): " << std::fixed << std::setprecision(6) << seconds << " sekund" << std::endl;
+        for(int t = 0; t < num_threads; t++) {
+            delete[] scratch_dist[t];
+            delete[] scratch_parent[t];
+        }
+        delete[] scratch_dist;
+        delete[] scratch_parent;
         
-        delete[] dist;
-        delete[] parent;
+        return result;
     }
     
-    double executeBellmanFordMatrix() {
-        auto start_time = std::chrono::high_resolution_clock::now();
-        
-        int* dist = new int[vertices];
-        int* parent = new int[vertices];
-        
-        for(int i = 0; i < vertices; i++) {
-            dist[i] = INT_MAX;
-            parent[i] = -1;
+    void batchQueries() {
+        std::cout << "\nZapytania wsadowe (wiele zrodel, Bellman-Ford):" << std::endl;
+        
+        int num_sources, num_targets, num_threads;
+        std::cout << "Podaj liczbe zapytan/zrodel (0 = wszystkie wierzcholki): ";
+        std::cin >> num_sources;
+        std::cout << "Podaj liczbe celow (0 = pelne tablice dist/parent): ";
+        std::cin >> num_targets;
+        std::cout << "Podaj liczbe watkow (0 = automatycznie): ";
+        std::cin >> num_threads;
+        
+        if(num_sources <= 0) num_sources = vertices;
+        if(num_targets < 0) num_targets = 0;
+        if(num_threads <= 0) num_threads = defaultThreadCount();
+        
+        int* sources = new int[num_sources];
+        for(int i = 0; i < num_sources; i++) {
+            sources[i] = (num_sources == vertices) ? i : rand() % vertices;
         }
-        dist[start_vertex] = 0;
         
-        // Relaksacja krawedzi (V-1) razy
-        for(int i = 0; i < vertices - 1; i++) {
-            for(int u = 0; u < vertices; u++) {
-                for(int v = 0; v < vertices; v++) {
-                    if(adjacency_matrix[u][v] != 0 && dist[u] != INT_MAX && 
-                       dist[u] + adjacency_matrix[u][v] < dist[v]) {
-                        dist[v] = dist[u] + adjacency_matrix[u][v];
-                        parent[v] = u;
-                    }
-                }
+        int* targets = nullptr;
+        if(num_targets > 0) {
+            targets = new int[num_targets];
+            for(int i = 0; i < num_targets; i++) {
+                targets[i] = rand() % vertices;
             }
         }
         
+        auto start_time = std::chrono::high_resolution_clock::now();
+        BatchResult* result = batchBellmanFord(sources, num_sources, targets, num_targets, num_threads);
         auto end_time = std::chrono::high_resolution_clock::now();
         auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(end_time - start_time);
         double seconds = duration.count() / 1000000000.0;
         
-        delete[] dist;
-        delete[] parent;
-        
-        return seconds;
-    }
-    
-    double executeBellmanFordList() {
-        auto start_time = std::chrono::high_resolution_clock::now();
+        int negative_count = 0;
+        for(int q = 0; q < num_sources; q++) {
+            if(result->negative_cycle[q]) negative_count++;
+        }
         
-        int* dist = new int[vertices];
-        int* parent = new int[vertices];
+        if(vertices <= 20) {
+            for(int q = 0; q < num_sources; q++) {
+                std::cout << "Zrodlo " << original_id[sources[q]] << ": ";
+                if(result->negative_cycle[q]) {
+                    std::cout << "CYKL UJEMNY" << std::endl;
+                    continue;
+                }
+                for(int i = 0; i < result->row_length; i++) {
+                    int d = result->dist[(size_t)q * result->row_length + i];
+                    int target = targets ? targets[i] : i;
+                    std::cout << original_id[target] << "=";
+                    if(d == INT_MAX) std::cout << "INF ";
+                    else std::cout << d << " ";
+                }
+                std::cout << std::endl;
+            }
+        }
         
-        for(int i = 0; i < vertices; i++) {
-            dist[i] = INT_MAX;
-            parent[i] = -1;
+        std::cout << "Zapytan: " << num_sources << ", watkow: " << num_threads 
+                  << ", z cyklem ujemnym: " << negative_count << std::endl;
+        std::cout << "Czas wykonania: " << std::fixed << std::setprecision(6) << seconds << " sekund" << std::endl;
+        if(seconds > 0) {
+            std::cout << "Przepustowosc: " << std::fixed << std::setprecision(1) << num_sources / seconds << " zapytan/s" << std::endl;
         }
-        dist[start_vertex] = 0;
         
-        // Relaksacja krawedzi (V-1) razy
-        for(int i = 0; i < vertices - 1; i++) {
-            for(int u = 0; u < vertices; u++) {
-                if(dist[u] != INT_MAX) {
-                    for(int j = 0; j < list_sizes[u]; j++) {
-                        int v = adjacency_list[u][j * 2];
-                        int weight = adjacency_list[u][j * 2 + 1];
-                        
-                        if(dist[u] + weight < dist[v]) {
-                            dist[v] = dist[u] + weight;
-                            parent[v] = u;
-                        }
-                    }
+        delete result;
+        delete[] sources;
+        delete[] targets;
+    }
+    
+    // ===== Najkrotsze sciezki miedzy wszystkimi parami (APSP) =====
+    // Wynikiem obu metod jest plaska macierz V x V (wiersz = zrodlo),
+    // INT_MAX oznacza brak sciezki.
+    
+    // "Nieskonczonosc" robocza Floyda-Warshalla: suma dwoch miesci sie w typie D, a wartosci
+    // od apspInfinity/2 w gore to brak sciezki (nieskonczonosc pomniejszona o wagi ujemne)
+    template<typename D>
+    static D apspInfinity() { return std::numeric_limits<D>::max() / 4; }
+    
+    static const int APSP_BLOCK = 64;     // bok bloku Floyda-Warshalla (3 bloki 64x64 int miesza sie w L1/L2)
+    
+    // Aktualizacja bloku [i0,i1) x [j0,j1) przez posrednie k z [k0,k1).
+    // Petla wewnetrzna bez rozgalezien, aby kompilator mogl ja zwektoryzowac.
+    template<typename D>
+    static void floydWarshallBlock(D* dist, int n, int i0, int i1, int j0, int j1, int k0, int k1) {
+        const D infinity = apspInfinity<D>();
+        for(int k = k0; k < k1; k++) {
+            const D* row_k = dist + (long long)k * n;
+            for(int i = i0; i < i1; i++) {
+                D* row_i = dist + (long long)i * n;
+                D dik = row_i[k];
+                if(dik >= infinity) continue;
+#if defined(__GNUC__)
+#pragma GCC ivdep
+#endif
+                for(int j = j0; j < j1; j++) {
+                    D candidate = dik + row_k[j];
+                    candidate = candidate < -infinity ? -infinity : candidate; // ograniczenie przy cyklach ujemnych
+                    row_i[j] = candidate < row_i[j] ? candidate : row_i[j];
                 }
             }
         }
+    }
+    
+    // Blokowy Floyd-Warshall: dla kazdego bloku przekatnej kolejno blok przekatnej,
+    // pozostale bloki jego wiersza i kolumny (rownolegle), a na koniec reszta macierzy (rownolegle).
+    // Odleglosci w int, gdy najdluzsza sciezka prosta lezy daleko ponizej progu braku sciezki,
+    // w przeciwnym razie w long long - duza odleglosc nie moze zostac uznana za brak sciezki.
+    int* floydWarshallBlocked(int num_threads, bool& negative_cycle) {
+        long long path_bound = (long long)graph.getMaxAbsWeight() * (vertices > 1 ? vertices - 1 : 1);
+        if(path_bound < apspInfinity<int>() / 4) return floydWarshallRun<int>(num_threads, negative_cycle);
+        return floydWarshallRun<long long>(num_threads, negative_cycle);
+    }
+    
+    template<typename D>
+    int* floydWarshallRun(int num_threads, bool& negative_cycle) {
+        const D infinity = apspInfinity<D>();
+        int n = vertices;
+        D* dist = new D[(long long)n * n];
+        
+        for(long long i = 0; i < (long long)n * n; i++) dist[i] = infinity;
+        for(int i = 0; i < n; i++) dist[(long long)i * n + i] = 0;
+        for(int u = 0; u < n; u++) {
+            for(int j = 0; j < list_sizes[u]; j++) {
+                int v = adjacency_list[u][j * 2];
+                int weight = adjacency_list[u][j * 2 + 1];
+                if(weight < dist[(long long)u * n + v]) dist[(long long)u * n + v] = weight;
+            }
+        }
         
-        auto end_time = std::chrono::high_resolution_clock::now();
-        auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(end_time - start_time);
-        double seconds = duration.count() / 1000000000.0;
+        if(num_threads < 1) num_threads = defaultThreadCount();
+        int blocks = (n + APSP_BLOCK - 1) / APSP_BLOCK;
         
-        delete[] dist;
-        delete[] parent;
+        for(int kb = 0; kb < blocks; kb++) {
+            int k0 = kb * APSP_BLOCK;
+            int k1 = (k0 + APSP_BLOCK < n) ? k0 + APSP_BLOCK : n;
+            
+            // Faza 1: blok na przekatnej
+            floydWarshallBlock(dist, n, k0, k1, k0, k1, k0, k1);
+            
+            // Faza 2: wiersz kb (zadania 0..blocks-1) i kolumna kb (zadania blocks..2*blocks-1)
+            parallelFor(2 * blocks, num_threads, [&](int task, int) {
+                int b = task % blocks;
+                if(b == kb) return;
+                int b0 = b * APSP_BLOCK;
+                int b1 = (b0 + APSP_BLOCK < n) ? b0 + APSP_BLOCK : n;
+                if(task < blocks) {
+                    floydWarshallBlock(dist, n, k0, k1, b0, b1, k0, k1);
+                } else {
+                    floydWarshallBlock(dist, n, b0, b1, k0, k1, k0, k1);
+                }
+            });
+            
+            // Faza 3: pozostale bloki - kazde zadanie to jeden pas wierszy
+            parallelFor(blocks, num_threads, [&](int ib, int) {
+                if(ib == kb) return;
+                int i0 = ib * APSP_BLOCK;
+                int i1 = (i0 + APSP_BLOCK < n) ? i0 + APSP_BLOCK : n;
+                for(int jb = 0; jb < blocks; jb++) {
+                    if(jb == kb) continue;
+                    int j0 = jb * APSP_BLOCK;
+                    int j1 = (j0 + APSP_BLOCK < n) ? j0 + APSP_BLOCK : n;
+                    floydWarshallBlock(dist, n, i0, i1, j0, j1, k0, k1);
+                }
+            });
+        }
+        
+        negative_cycle = false;
+        for(int i = 0; i < n; i++) {
+            if(dist[(long long)i * n + i] < 0) negative_cycle = true;
+        }
+        
+        // Wynik w int: bez cyklu ujemnego odleglosci mieszcza sie w int (Graph::distancesFitInt),
+        // z cyklem ujemnym wartosci sa nasycane
+        int* result = sizeof(D) == sizeof(int) ? reinterpret_cast<int*>(dist) : new int[(long long)n * n];
+        for(long long i = 0; i < (long long)n * n; i++) {
+            if(dist[i] >= infinity / 2) result[i] = INT_MAX;
+            else if(dist[i] >= INT_MAX) result[i] = INT_MAX - 1;
+            else if(dist[i] < INT_MIN) result[i] = INT_MIN;
+            else result[i] = (int)dist[i];
+        }
+        if(sizeof(D) != sizeof(int)) delete[] dist;
         
-        return seconds;
+        return result;
     }
     
-    void performPerformanceTests() {
-        std::cout << "\n=== TESTY WYDAJNOSCI ALGORYTMU BELLMANA-FORDA ===" << std::endl;
-        std::cout << "Zgodnie z wymaganiami projektu:" << std::endl;
-        std::cout << "- 7 rozmiarow grafow" << std::endl;
-        std::cout << "- 3 gestosci: 20%, 60%, 99%" << std::endl;
-        std::cout << "- 50 instancji dla kazdego zestawu" << std::endl;
-        std::cout << "- Wyniki usrednione\n" << std::endl;
+    // Algorytm Johnsona: potencjaly z jednego przebiegu Bellmana-Forda (wirtualne zrodlo
+    // polaczone krawedziami 0 z kazdym wierzcholkiem), przewazenie krawedzi do wag nieujemnych
+    // i rownolegle przebiegi Dijkstry z kopcem z kazdego wierzcholka.
+    // Zwraca nullptr, gdy graf zawiera cykl ujemny.
+    int* johnson(int num_threads, bool& negative_cycle) {
+        int n = vertices;
+        int* h = new int[n];
+        int* parent = new int[n];
+        for(int i = 0; i < n; i++) {
+            h[i] = 0; // pierwsza runda z wirtualnego zrodla
+            parent[i] = -1;
+        }
+        negative_cycle = relaxUntilStable(h, parent);
+        delete[] parent;
+        
+        if(negative_cycle) {
+            delete[] h;
+            return nullptr;
+        }
+        
+        // CSR z wagami przewazonymi w' = w + h[u] - h[v] >= 0
+        int* offsets = new int[n + 1];
+        offsets[0] = 0;
+        for(int u = 0; u < n; u++) offsets[u + 1] = offsets[u] + list_sizes[u];
+        int* targets = new int[offsets[n]];
+        int* weights = new int[offsets[n]];
+        for(int u = 0; u < n; u++) {
+            for(int j = 0; j < list_sizes[u]; j++) {
+                int v = adjacency_list[u][j * 2];
+                targets[offsets[u] + j] = v;
+                weights[offsets[u] + j] = adjacency_list[u][j * 2 + 1] + h[u] - h[v];
+            }
+        }
         
-        int test_sizes[] = {100, 200, 300, 400, 500, 600, 700};
-        int densities[] = {20, 60, 99};
-        int num_tests = 50;
+        int* dist = new int[(long long)n * n];
         
-        for(int size_idx = 0; size_idx < 7; size_idx++) {
-            int v = test_sizes[size_idx];
+        if(num_threads < 1) num_threads = defaultThreadCount();
+        if(num_threads > n) num_threads = n;
+        bool** scratch_settled = new bool*[num_threads];
+        MinHeap** heaps = new MinHeap*[num_threads];
+        for(int t = 0; t < num_threads; t++) {
+            scratch_settled[t] = new bool[n];
+            heaps[t] = new MinHeap(n);
+        }
+        
+        parallelFor(n, num_threads, [&](int source, int t) {
+            int* row = dist + (long long)source * n;
+            bool* settled = scratch_settled[t];
+            MinHeap& heap = *heaps[t];
             
-            for(int dens_idx = 0; dens_idx < 3; dens_idx++) {
-                int density = densities[dens_idx];
-                
-                double total_time_matrix = 0.0;
-                double total_time_list = 0.0;
-                
-                std::cout << "Testowanie " << v << " wierzcholkow, gestosc " << density << "%... ";
-                std::cout.flush();
+            for(int i = 0; i < n; i++) {
+                row[i] = INT_MAX;
+                settled[i] = false;
+            }
+            heap.clear();
+            row[source] = 0;
+            heap.insert(source, 0);
+            
+            while(!heap.isEmpty()) {
+                int u = heap.extractMin().vertex;
+                settled[u] = true;
                 
-                for(int test = 0; test < num_tests; test++) {
-                    generateRandomForTesting(v, density);
-                    
-                    double time_matrix = executeBellmanFordMatrix();
-                    total_time_matrix += time_matrix;
-                    
-                    double time_list = executeBellmanFordList();
-                    total_time_list += time_list;
+                for(int e = offsets[u]; e < offsets[u + 1]; e++) {
+                    int v = targets[e];
+                    if(!settled[v] && row[u] + weights[e] < row[v]) {
+                        row[v] = row[u] + weights[e];
+                        if(heap.isInHeap(v)) {
+                            heap.decreaseKey(v, row[v]);
+                        } else {
+                            heap.insert(v, row[v]);
+                        }
+                    }
                 }
-                
-                double avg_time_matrix = total_time_matrix / num_tests;
-                double avg_time_list = total_time_list / num_tests;
-                
-                std::cout << "GOTOWE" << std::endl;
-                
-                std::cout << "ilosc wierzcholkow = " << v << " gestosc = " << density << " reprezentacja = macierzowa" << std::endl;
-                std::cout << "czas w sekundach = " << std::fixed << std::setprecision(6) << avg_time_matrix << std::endl;
-                std::cout << std::endl;
-                
-                std::cout << "ilosc wierzcholkow = " << v << " gestosc = " << density << " reprezentacja = listowa" << std::endl;
-                std::cout << "czas w sekundach = " << std::fixed << std::setprecision(6) << avg_time_list << std::endl;
-                std::cout << std::endl;
             }
+            
+            // Powrot do oryginalnych wag: d(s,v) = d'(s,v) - h[s] + h[v]
+            for(int v = 0; v < n; v++) {
+                if(row[v] != INT_MAX) row[v] = row[v] - h[source] + h[v];
+            }
+        });
+        
+        for(int t = 0; t < num_threads; t++) {
+            delete[] scratch_settled[t];
+            delete heaps[t];
+        }
+        delete[] scratch_settled;
+        delete[] heaps;
+        delete[] offsets;
+        delete[] targets;
+        delete[] weights;
+        delete[] h;
+        
+        return dist;
+    }
+    
+    // Zapis macierzy odleglosci w formacie binarnym:
+    // 4 bajty "APSP", int32 liczba wierzcholkow, nastepnie V*V int32 wierszami (INT_MAX = brak sciezki)
+    bool saveDistanceMatrix(const std::string& filename, const int* dist) {
+        std::ofstream file(filename, std::ios::binary);
+        if(!file.is_open()) {
+            std::cout << "Blad: Nie mozna utworzyc pliku " << filename << std::endl;
+            return false;
         }
         
-        std::cout << "=== KONIEC TESTOW WYDAJNOSCI ===" << std::endl;
+        int n = vertices;
+        file.write("APSP", 4);
+        file.write(reinterpret_cast<const char*>(&n), sizeof(int));
+        file.write(reinterpret_cast<const char*>(dist), (std::streamsize)((long long)n * n * sizeof(int)));
+        file.close();
+        return true;
     }
-};
-
-int main() {
-    srand(time(nullptr));
-    Graph* graph = nullptr;
-    int choice;
-    
-    std::cout << "=== ALGORYTM BELLMANA-FORDA - NAJKROTSZE SCIEZKI ===" << std::endl;
-    
-    do {
-        std::cout << "\n--- MENU ---" << std::endl;
-        std::cout << "1. Wczytaj z pliku" << std::endl;
-        std::cout << "2. Wygeneruj graf losowo" << std::endl;
-        std::cout << "3. Wyswietl listowo i macierzowo" << std::endl;
-        std::cout << "4. Algorytm Bellmana-Forda - macierzowo" << std::endl;
-        std::cout << "5. Algorytm Bellmana-Forda - listowo" << std::endl;
-        std::cout << "6. Testy wydajnosci (zgodnie z wymaganiami)" << std::endl;
-        std::cout << "0. Wyjscie" << std::endl;
-        std::cout << "Wybierz opcje: ";
-        std::cin >> choice;
-        
-        switch(choice) {
-            case 1: {
-                std::string filename;
-                std::cout << "Podaj nazwe pliku: ";
-                std::cin >> filename;
-                
-                if(graph) delete graph;
-                graph = new Graph(10);
-                graph->loadFromFile(filename);
-                break;
-            }
-            case 2: {
-                int vertices, density;
-                std::cout << "Podaj liczbe wierzcholkow: ";
-                std::cin >> vertices;
-                std::cout << "Podaj gestosc grafu (w %): ";
-                std::cin >> density;
-                
-                if(graph) delete graph;
-                graph = new Graph(vertices);
-                graph->generateRandom(vertices, density);
-                break;
-            }
-            case 3: {
-                if(graph) {
-                    graph->displayMatrix();
-                    graph->displayList();
-                } else {
-                    std::cout << "Brak grafu! Wczytaj lub wygeneruj graf." << std::endl;
+    
+    void allPairsShortestPaths() {
+        int method, num_threads;
+        std::string filename;
+        std::cout << "\nNajkrotsze sciezki miedzy wszystkimi parami:" << std::endl;
+        std::cout << "1. Blokowy Floyd-Warshall" << std::endl;
+        std::cout << "2. Algorytm Johnsona" << std::endl;
+        std::cout << "3. Obie metody z porownaniem wynikow" << std::endl;
+        std::cout << "Wybierz metode: ";
+        std::cin >> method;
+        std::cout << "Podaj liczbe watkow (0 = automatycznie): ";
+        std::cin >> num_threads;
+        std::cout << "Podaj plik wynikowy (- = bez zapisu): ";
+        std::cin >> filename;
+        
+        if(method < 1 || method > 3) {
+            std::cout << "Nieprawidlowa opcja!" << std::endl;
+            return;
+        }
+        if(num_threads <= 0) num_threads = defaultThreadCount();
+        
+        int* fw_dist = nullptr;
+        int* johnson_dist = nullptr;
+        bool negative_cycle = false;
+        
+        if(method == 1 || method == 3) {
+            auto start_time = std::chrono::high_resolution_clock::now();
+            fw_dist = floydWarshallBlocked(num_threads, negative_cycle);
+            auto end_time = std::chrono::high_resolution_clock::now();
+            double seconds = std::chrono::duration_cast<std::chrono::nanoseconds>(end_time - start_time).count() / 1000000000.0;
+            std::cout << "Floyd-Warshall: " << std::fixed << std::setprecision(6) << seconds << " sekund" << std::endl;
+        }
+        
+        if(method == 2 || method == 3) {
+            auto start_time = std::chrono::high_resolution_clock::now();
+            johnson_dist = johnson(num_threads, negative_cycle);
+            auto end_time = std::chrono::high_resolution_clock::now();
+            double seconds = std::chrono::duration_cast<std::chrono::nanoseconds>(end_time - start_time).count() / 1000000000.0;
+            std::cout << "Johnson: " << std::fixed << std::setprecision(6) << seconds << " sekund" << std::endl;
+        }
+        
+        if(negative_cycle) {
+            std::cout << "WYKRYTO CYKL UJEMNY W GRAFIE!" << std::endl;
+        } else {
+            int* dist = fw_dist ? fw_dist : johnson_dist;
+            
+            if(fw_dist && johnson_dist) {
+                long long differences = 0;
+                for(long long i = 0; i < (long long)vertices * vertices; i++) {
+                    if(fw_dist[i] != johnson_dist[i]) differences++;
                 }
-                break;
-            }
-            case 4: {
-                if(graph) {
-                    graph->bellmanFordMatrix();
+                if(differences == 0) {
+                    std::cout << "Wyniki obu metod sa zgodne." << std::endl;
                 } else {
-                    std::cout << "Brak grafu! Wczytaj lub wygeneruj graf." << std::endl;
+                    std::cout << "BLAD: " << differences << " roznych odleglosci!" << std::endl;
                 }
-                break;
             }
-            case 5: {
-                if(graph) {
-                    graph->bellmanFordList();
-                } else {
-                    std::cout << "Brak grafu! Wczytaj lub wygeneruj graf." << std::endl;
+            
+            // Wiersze i kolumny w numeracji wejsciowej (po ewentualnej zmianie numeracji)
+            int* ordered = new int[(long long)vertices * vertices];
+            for(int i = 0; i < vertices; i++) {
+                int* row = dist + (long long)current_id[i] * vertices;
+                for(int j = 0; j < vertices; j++) {
+                    ordered[(long long)i * vertices + j] = row[current_id[j]];
                 }
-                break;
             }
-            case 6: {
-                std::cout << "Uwaga: Testy wydajnosci moga potrwac kilka minut..." << std::endl;
-                std::cout << "Czy kontynuowac? (t/n): ";
-                char confirm;
-                std::cin >> confirm;
-                if(confirm == 't' || confirm == 'T') {
-                    if(graph) delete graph;
-                    graph = new Graph(10);
-                    graph->performPerformanceTests();
+            dist = ordered;
+            
+            if(vertices <= 20) {
+                std::cout << "\nMacierz odleglosci:" << std::endl;
+                for(int i = 0; i < vertices; i++) {
+                    std::cout << i << ": ";
+                    for(int j = 0; j < vertices; j++) {
+                        int d = dist[i * vertices + j];
+                        if(d == INT_MAX) std::cout << "INF  ";
+                        else std::cout << d << "  ";
+                    }
+                    std::cout << std::endl;
                 }
-                break;
             }
-            case 0:
-                std::cout << "Koniec programu." << std::endl;
-                break;
-            default:
-                std::cout << "Nieprawidlowa opcja!" << std::endl;
+            
+            if(filename != "-" && saveDistanceMatrix(filename, dist)) {
+                std::cout << "Macierz odleglosci zapisana do pliku " << filename << std::endl;
+            }
+            delete[] ordered;
         }
-    } while(choice != 0);
+        
+        delete[] fw_dist;
+        delete[] johnson_dist;
+    }
     
-    if(graph) delete graph;
-    return 0;
+    // Dodatkowe silniki porownywane z wynikiem referencyjnym trybu weryfikacji:
+    // wczesne zakonczenie, kolejnosc Yena, zapytania wsadowe oraz Floyd-Warshall i Johnson. Generator
+    // zapewnia cykl Hamiltona, wiec cykl ujemny w grafie jest zawsze osiagalny ze startu.
+    static const int VERIFY_APSP_LIMIT = 1000; // Floyd-Warshall i Johnson tylko dla mniejszych grafow
+    
+    void verifyEngines(VerificationContext& ctx, const AlgorithmOutput& reference) {
+        int* dist = new int[vertices];
+        int* parent = new int[vertices];
+        bool cycle = false;
+        
+        auto check = [&](const std::string& variant, const int* result, bool result_cycle) {
+            if(!checkValue(ctx, variant + " (cykl ujemny)", reference.negative_cycle, result_cycle)) return;
+            if(!reference.negative_cycle && result) checkDistances(ctx, variant, reference.dist, result, vertices);
+        };
+        
+        cycle = bellmanFordFromSource(start_vertex, dist, parent);
+        check("bellman-ford: wczesne zakonczenie", dist, cycle);
+        
+        graph.buildNarrowMatrix();
+        for(int representation = 0; representation < REP_COUNT; representation++) {
+            if(!(REP_MASK_ALL & (1 << representation))) continue;
+            bellmanFordArray(true, representation, dist, parent);
+            check(std::string("bellman-ford: kolejnosc Yena, reprezentacja ") + representationName(representation), dist,
+                  hasNegativeCycle(representation, dist));
+        }
+        
+        BatchResult* batch = batchBellmanFord(&start_vertex, 1, nullptr, 0, defaultThreadCount());
+        check("bellman-ford: zapytania wsadowe", batch->dist, batch->negative_cycle[0]);
+        delete batch;
+        
+        if(vertices <= VERIFY_APSP_LIMIT) {
+            int* all = floydWarshallBlocked(defaultThreadCount(), cycle);
+            check("bellman-ford: Floyd-Warshall", all + (long long)start_vertex * vertices, cycle);
+            delete[] all;
+            all = johnson(defaultThreadCount(), cycle);
+            check("bellman-ford: Johnson", all ? all + (long long)start_vertex * vertices : nullptr, cycle);
+            delete[] all;
+        }
+        
+        delete[] dist;
+        delete[] parent;
+    }
+};
+
+// Wspolne przebiegi obu wariantow; yen - kolejnosc Yena z wczesnym zakonczeniem
+static void bellmanFordRunVariant(Graph& graph, int representation, bool yen) {
+    std::cout << "\nAlgorytm Bellmana-Forda" << (yen ? " (kolejnosc Yena)" : "") << " - reprezentacja "
+              << representationName(representation) << ":" << std::endl;
+    std::cout << "Wierzcholek startowy: " << graph.getOriginalId()[graph.getStartVertex()] << std::endl;
+    
+    int* dist = new int[graph.getVertices()];
+    int* parent = new int[graph.getVertices()];
+    BellmanFordSolver solver(graph);
+    // Zwarta macierz jest reprezentacja grafu - budowana poza pomiarem, jak macierz int
+    if(representation == REP_MATRIX) graph.buildNarrowMatrix();
+    
+    auto start_time = std::chrono::high_resolution_clock::now();
+    int rounds = solver.bellmanFordArray(yen, representation, dist, parent);
+    bool has_negative_cycle = solver.hasNegativeCycle(representation, dist);
+    auto end_time = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(end_time - start_time);
+    double seconds = duration.count() / 1000000000.0;
+    
+    if(has_negative_cycle) {
+        std::cout << "WYKRYTO CYKL UJEMNY W GRAFIE!" << std::endl;
+    } else {
+        printShortestPaths(graph, dist, parent);
+    }
+    std::cout << "Rundy relaksacji: " << rounds << std::endl;
+    std::cout << "Czas wykonania (reprezentacja " << representationName(representation) << "): "
+              << std::fixed << std::setprecision(6) << seconds << " sekund" << std::endl;
+    
+    delete[] dist;
+    delete[] parent;
+}
+
+static double bellmanFordExecuteVariant(Graph& graph, int representation, AlgorithmOutput* output, bool yen) {
+    int* dist = new int[graph.getVertices()];
+    int* parent = new int[graph.getVertices()];
+    BellmanFordSolver solver(graph);
+    // Zwarta macierz jest reprezentacja grafu - budowana poza pomiarem, jak macierz int
+    if(representation == REP_MATRIX) graph.buildNarrowMatrix();
+    
+    auto start_time = std::chrono::high_resolution_clock::now();
+    lastRunStatistics().rounds = solver.bellmanFordArray(yen, representation, dist, parent);
+    auto end_time = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(end_time - start_time);
+    double seconds = duration.count() / 1000000000.0;
+    
+    // Wyniki dla trybu weryfikacji (poza mierzonym czasem)
+    if(output) {
+        output->negative_cycle = solver.hasNegativeCycle(representation, dist);
+        for(int i = 0; i < graph.getVertices(); i++) output->dist[i] = dist[i];
+        if(output->parent) {
+            for(int i = 0; i < graph.getVertices(); i++) output->parent[i] = parent[i];
+        }
+    }
+    
+    delete[] dist;
+    delete[] parent;
+    return seconds;
+}
+
+static void bellmanFordRun(Graph& graph, int representation) {
+    bellmanFordRunVariant(graph, representation, false);
+}
+
+static double bellmanFordExecute(Graph& graph, int representation, AlgorithmOutput* output) {
+    return bellmanFordExecuteVariant(graph, representation, output, false);
+}
+
+static void bellmanFordYenRun(Graph& graph, int representation) {
+    bellmanFordRunVariant(graph, representation, true);
+}
+
+static double bellmanFordYenExecute(Graph& graph, int representation, AlgorithmOutput* output) {
+    return bellmanFordExecuteVariant(graph, representation, output, true);
+}
+
+static void bellmanFordVerify(Graph& graph, VerificationContext& ctx, const AlgorithmOutput& reference) {
+    BellmanFordSolver solver(graph);
+    solver.verifyEngines(ctx, reference);
 }
+
+static void bellmanFordMenu(Graph& graph) {
+    int option;
+    std::cout << "\nAlgorytm Bellmana-Forda - opcje dodatkowe:" << std::endl;
+    std::cout << "1. Zapytania wsadowe (wiele zrodel, rownolegle)" << std::endl;
+    std::cout << "2. Najkrotsze sciezki miedzy wszystkimi parami (APSP)" << std::endl;
+    std::cout << "3. Naprawa sciezek po zmianach krawedzi (przyrostowo)" << std::endl;
+    std::cout << "Wybierz opcje: ";
+    std::cin >> option;
+    
+    BellmanFordSolver solver(graph);
+    switch(option) {
+        case 1: solver.batchQueries(); break;
+        case 2: solver.allPairsShortestPaths(); break;
+        case 3: dynamicShortestPathsMenu(graph, *findAlgorithm("bellman-ford"), true); break;
+        default: std::cout << "Nieprawidlowa opcja!" << std::endl;
+    }
+}
+
+static const int bellman_ford_test_sizes[] = {100, 200, 300, 400, 500, 600, 700};
+
+static const AlgorithmInfo bellman_ford_info = {
+    "bellman-ford", "Algorytm Bellmana-Forda (najkrotsze sciezki, ujemne wagi)", GRAPH_DIRECTED_NEGATIVE, true, REP_MASK_ALL,
+    bellman_ford_test_sizes, 7, 50,
+    bellmanFordRun, bellmanFordExecute, bellmanFordVerify, bellmanFordMenu
+};
+
+// Wariant Yena testowany na tych samych rozmiarach - porownanie czasu i liczby rund
+// z klasycznym; zgodnosc wynikow sprawdza weryfikacja klasycznego Bellmana-Forda
+static const AlgorithmInfo bellman_ford_yen_info = {
+    "bellman-ford-yen", "Algorytm Bellmana-Forda z kolejnoscia Yena i wczesnym zakonczeniem", GRAPH_DIRECTED_NEGATIVE, true,
+    REP_MASK_ALL, bellman_ford_test_sizes, 7, 50,
+    bellmanFordYenRun, bellmanFordYenExecute, nullptr, bellmanFordMenu
+};
+
+static AlgorithmRegistrar bellman_ford_registrar(bellman_ford_info);
+static AlgorithmRegistrar bellman_ford_yen_registrar(bellman_ford_yen_info);
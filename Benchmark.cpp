@@ -0,0 +1,894 @@
+#include "Benchmark.h"
+#include "Reordering.h"
+#include "PerfCounters.h"
+#include "MemoryStats.h"
+#include "Statistics.h"
+#include "Baseline.h"
+#include "Scaling.h"
+#include <iostream>
+#include <iomanip>
+#include <cstdlib>
+#include <ctime>
+#include <string>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+#include "Parallel.h"
+
+static const int NUM_DENSITIES = 3;
+static const int test_densities[NUM_DENSITIES] = {20, 60, 99};
+
+static bool hasRepresentation(const AlgorithmInfo& algorithm, int representation) {
+    return (algorithm.representations & (1 << representation)) != 0;
+}
+
+// Porownanie wyniku wariantu z wynikiem referencyjnym; dist w numeracji referencji
+static void compareOutputs(VerificationContext& ctx, const AlgorithmInfo& algorithm, const std::string& variant,
+                           const AlgorithmOutput& reference, const AlgorithmOutput& output, int vertices) {
+    std::string label = std::string(algorithm.name) + ": " + variant;
+    if(!algorithm.shortest_paths) {
+        checkValue(ctx, label, reference.weight, output.weight);
+        return;
+    }
+    if(!checkValue(ctx, label + " (cykl ujemny)", reference.negative_cycle, output.negative_cycle)) return;
+    if(!reference.negative_cycle) checkDistances(ctx, label, reference.dist, output.dist, vertices);
+}
+
+void crossCheck(Graph& graph, const AlgorithmInfo& algorithm, VerificationContext& ctx) {
+    int vertices = graph.getVertices();
+    AlgorithmOutput reference, output;
+    int* dist = nullptr;
+    int* remapped = nullptr;
+    if(algorithm.shortest_paths) {
+        reference.dist = new int[vertices];
+        dist = new int[vertices];
+        remapped = new int[vertices];
+    }
+    
+    // Wynik referencyjny z pierwszej dostepnej reprezentacji
+    int first = 0;
+    while(!hasRepresentation(algorithm, first)) first++;
+    algorithm.execute(graph, first, &reference);
+    
+    output.dist = dist;
+    for(int representation = first + 1; representation < REP_COUNT; representation++) {
+        if(!hasRepresentation(algorithm, representation)) continue;
+        algorithm.execute(graph, representation, &output);
+        compareOutputs(ctx, algorithm, std::string("reprezentacja ") + representationName(representation),
+                       reference, output, vertices);
+    }
+    
+    if(algorithm.verify) algorithm.verify(graph, ctx, reference);
+    
+    // Wyniki w innej numeracji sprowadzane do numeracji sprzed zmiany (back[nowy] = stary)
+    int* previous = new int[vertices];
+    int* back = new int[vertices];
+    const int* original_id = graph.getOriginalId();
+    for(int u = 0; u < vertices; u++) previous[u] = original_id[u];
+    
+    for(int ordering = ORDER_BFS; ordering <= ORDER_DEGREE; ordering++) {
+        graph.applyOrdering(ordering);
+        const int* current_id = graph.getCurrentId();
+        for(int u = 0; u < vertices; u++) back[current_id[previous[u]]] = u;
+        std::string suffix = std::string(", numeracja ") + orderingName(ordering);
+        
+        for(int representation = 0; representation < REP_COUNT; representation++) {
+            if(!hasRepresentation(algorithm, representation)) continue;
+            AlgorithmOutput reordered;
+            reordered.dist = dist;
+            algorithm.execute(graph, representation, &reordered);
+            if(algorithm.shortest_paths) {
+                for(int u = 0; u < vertices; u++) remapped[back[u]] = dist[u];
+                reordered.dist = remapped;
+            }
+            compareOutputs(ctx, algorithm, std::string("reprezentacja ") + representationName(representation) + suffix,
+                           reference, reordered, vertices);
+        }
+        
+        graph.relabelVertices(back);
+    }
+    
+    delete[] previous;
+    delete[] back;
+    delete[] reference.dist;
+    delete[] dist;
+    delete[] remapped;
+}
+
+// Wynik pomiaru jednej instancji
+struct InstanceResult {
+    double time[REP_COUNT];
+    int rounds[REP_COUNT]; // RunStatistics::rounds przebiegu (0 - algorytm nie podaje)
+    long long counters[REP_COUNT][PERF_EVENT_COUNT];
+    MemoryUsage memory_build;
+    bool build_measured;
+    MemoryUsage memory_run[REP_COUNT];
+    int mismatches;
+    
+    InstanceResult() : build_measured(false), mismatches(0) {
+        for(int r = 0; r < REP_COUNT; r++) {
+            time[r] = 0.0;
+            rounds[r] = 0;
+            for(int e = 0; e < PERF_EVENT_COUNT; e++) counters[r][e] = 0;
+        }
+    }
+};
+
+// Powod zakonczenia zestawu w trybie adaptacyjnym
+enum CellStop {
+    STOP_LIMIT = 0,      // osiagnieto liczbe instancji
+    STOP_CONFIDENCE = 1, // przedzial ufnosci mediany ponizej celu
+    STOP_BUDGET = 2      // wyczerpany budzet czasu
+};
+
+// Ziarna instancji: graf rodzaju k o V wierzcholkach i gestosci d, instancja i ->
+// base_seed + groupSeed(k, V, d) * SEED_STRIDE + i, niezaleznie od algorytmu, od liczby watkow
+// i od tego, ile instancji zestaw ostatecznie zuzyl - algorytmy tego samego rodzaju grafu
+// sa mierzone na tych samych instancjach
+static const int SEED_STRIDE = 65536;
+static const int ADAPTIVE_MAX_TESTS = 200;
+
+// Zestaw testow: algorytm, rozmiar i gestosc. Liczba instancji miesci sie
+// w [min_tests, max_tests]; w trybie stalym min_tests == max_tests.
+struct BenchmarkCell {
+    const AlgorithmInfo* algorithm;
+    int group;
+    int vertices;
+    int density;
+    int min_tests;
+    int max_tests;
+    
+    // Postep (pod blokada planisty)
+    int issued;
+    int done;
+    bool closed;
+    int stop;
+    std::chrono::steady_clock::time_point start;
+    InstanceResult* results; // w kolejnosci zakonczenia
+    
+    bool complete() const {
+        return done == issued && (closed || issued == max_tests);
+    }
+};
+
+// Zestawy algorytmow jednego rodzaju grafu o tym samym rozmiarze i gestosci: instancja
+// jest generowana raz i mierzona kolejno przez wszystkie algorytmy grupy, ktore jej potrzebuja
+struct BenchmarkGroup {
+    int kind;
+    int vertices;
+    int density;
+    int representations; // suma masek reprezentacji algorytmow grupy
+    int max_tests;
+    int* cells;
+    int num_cells;
+    
+    int issued; // pod blokada planisty
+};
+
+// Stan wspolny planisty: watki pobieraja kolejne instancje biezacej grupy zestawow,
+// a watek glowny wypisuje zestawy po kolei, gdy wszystkie ich instancje sa gotowe
+struct BenchmarkSchedule {
+    BenchmarkCell* cells;
+    int num_cells;
+    BenchmarkGroup* groups;
+    int num_groups;
+    int current_group;
+    unsigned int base_seed;
+    const BenchmarkOptions* options;
+    bool adaptive;
+    int warmup;
+    bool collect_counters;
+    bool generate_ahead;
+    bool track_memory;
+    int pin_skip;
+    
+    std::atomic<int> pinned_workers;
+    std::mutex lock;
+    std::condition_variable finished;
+};
+
+static unsigned int groupSeed(int kind, int vertices, int density) {
+    return mixSeed(mixSeed((unsigned int)vertices) ^ (unsigned int)(kind * 128 + density));
+}
+
+static VerificationContext taskContext(const BenchmarkSchedule& schedule, int group_index, int instance) {
+    const BenchmarkGroup& group = schedule.groups[group_index];
+    VerificationContext ctx;
+    ctx.seed = schedule.base_seed + groupSeed(group.kind, group.vertices, group.density) * SEED_STRIDE + (unsigned int)instance;
+    ctx.vertices = group.vertices;
+    ctx.density = group.density;
+    return ctx;
+}
+
+// Instancja testowa grupy wyznaczona przez ziarno kontekstu. Zwarte macierze wag powstaja
+// razem z grafem (wliczaja sie do pamieci budowy), ale tylko te, ktorych reprezentacje algorytmy
+// grupy mierza - przebiegi listowe nie placa za macierz V*V.
+// Budowa w jednym watku - generator w tle i rownolegle watki pomiarowe dzialaja obok
+// mierzonych przebiegow i nie moga zajmowac ich rdzeni.
+static void generateInstance(Graph& graph, const VerificationContext& ctx, const BenchmarkGroup& group) {
+    graph.generateRandomForTesting(ctx.vertices, ctx.density, group.kind, ctx.seed, 1);
+    if(group.representations & (1 << REP_MATRIX)) graph.buildNarrowMatrix();
+    if((group.representations & (1 << REP_TRIANGULAR)) && group.kind == GRAPH_UNDIRECTED) graph.buildTriangularMatrix();
+}
+
+// Kolejna instancja biezacej grupy; task_cells - zestawy grupy, ktore jej potrzebuja
+// (zestaw konczy sie przed grupa, wiec jego instancje to zawsze poczatkowe instancje grupy)
+static bool claimTask(BenchmarkSchedule& schedule, int& group_index, int& instance, int* task_cells, int& task_count) {
+    std::lock_guard<std::mutex> guard(schedule.lock);
+    while(schedule.current_group < schedule.num_groups) {
+        BenchmarkGroup& group = schedule.groups[schedule.current_group];
+        task_count = 0;
+        for(int i = 0; i < group.num_cells; i++) {
+            BenchmarkCell& cell = schedule.cells[group.cells[i]];
+            if(cell.closed || cell.issued >= cell.max_tests) continue;
+            if(cell.issued == 0) {
+                cell.start = std::chrono::steady_clock::now();
+                cell.results = new InstanceResult[cell.max_tests];
+            }
+            cell.issued++;
+            task_cells[task_count++] = group.cells[i];
+        }
+        if(task_count > 0) {
+            group_index = schedule.current_group;
+            instance = group.issued++;
+            return true;
+        }
+        schedule.current_group++;
+    }
+    return false;
+}
+
+// Kolejna instancja w trybie stalym i szeregowym (tylko wtedy da sie ja przewidziec)
+static bool followingTask(const BenchmarkSchedule& schedule, int group_index, int instance,
+                          int& next_group, int& next_instance) {
+    if(instance + 1 < schedule.groups[group_index].max_tests) {
+        next_group = group_index;
+        next_instance = instance + 1;
+        return true;
+    }
+    next_group = group_index + 1;
+    next_instance = 0;
+    return next_group < schedule.num_groups;
+}
+
+// Czasy wszystkich instancji zestawu dla reprezentacji (bufor o rozmiarze cell.done)
+static void cellTimes(const BenchmarkCell& cell, int representation, double* times) {
+    for(int test = 0; test < cell.done; test++) times[test] = cell.results[test].time[representation];
+}
+
+static MedianInterval cellInterval(const BenchmarkCell& cell, int representation) {
+    double* times = new double[cell.done];
+    cellTimes(cell, representation, times);
+    MedianInterval interval = medianInterval(times, cell.done);
+    delete[] times;
+    return interval;
+}
+
+// Zestaw zbiegl, gdy przedzialy median wszystkich reprezentacji sa dostatecznie waskie
+static bool cellConverged(const BenchmarkCell& cell, double target) {
+    for(int representation = 0; representation < REP_COUNT; representation++) {
+        if(!hasRepresentation(*cell.algorithm, representation)) continue;
+        if(cellInterval(cell, representation).relativeHalfWidth() > target) return false;
+    }
+    return true;
+}
+
+static void finishTask(BenchmarkSchedule& schedule, int cell_index, const InstanceResult& result) {
+    {
+        std::lock_guard<std::mutex> guard(schedule.lock);
+        BenchmarkCell& cell = schedule.cells[cell_index];
+        cell.results[cell.done++] = result;
+        
+        if(schedule.adaptive && !cell.closed && cell.done >= cell.min_tests) {
+            std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - cell.start;
+            if(cellConverged(cell, schedule.options->target_ci)) {
+                cell.closed = true;
+                cell.stop = STOP_CONFIDENCE;
+            } else if(elapsed.count() >= schedule.options->time_budget) {
+                cell.closed = true;
+                cell.stop = STOP_BUDGET;
+            }
+        }
+    }
+    schedule.finished.notify_all();
+}
+
+// Watek pomiarowy: wlasne bufory grafu i wlasne liczniki sprzetowe (liczniki
+// dotycza watku, ktory je otworzyl). Przy generowaniu w tle (tylko jeden watek
+// pomiarowy) kolejna instancja powstaje w drugim buforze podczas pomiaru biezacej.
+// Na pierwszej instancji kazdej grupy watek wykonuje przebiegi rozgrzewkowe.
+// Weryfikacja zmienia numeracje grafu, wiec idzie po pomiarach wszystkich algorytmow instancji.
+static void benchmarkWorker(BenchmarkSchedule& schedule, int slot) {
+    const BenchmarkOptions& options = *schedule.options;
+    if(options.pin_workers && pinCurrentThread(slot, schedule.pin_skip)) schedule.pinned_workers++;
+    
+    PerfCounters* counters = schedule.collect_counters ? new PerfCounters() : nullptr;
+    MemoryScope memory;
+    Graph first(1, false), second(1, false);
+    Graph* measured = &first;
+    Graph* ahead = &second;
+    int ahead_group = -1, ahead_instance = -1;
+    int last_group = -1;
+    int group_index, instance, task_count;
+    int* task_cells = new int[algorithmCount()];
+    InstanceResult* results = new InstanceResult[algorithmCount()];
+    
+    while(claimTask(schedule, group_index, instance, task_cells, task_count)) {
+        VerificationContext ctx = taskContext(schedule, group_index, instance);
+        MemoryUsage memory_build;
+        bool build_measured = false;
+        
+        if(ahead_group == group_index && ahead_instance == instance) {
+            Graph* swap = measured;
+            measured = ahead;
+            ahead = swap;
+        } else {
+            if(schedule.track_memory) memory.start();
+            generateInstance(*measured, ctx, schedule.groups[group_index]);
+            if(schedule.track_memory) {
+                memory_build = memory.stop();
+                build_measured = true;
+            }
+        }
+        
+        // Drugi graf przygotowany przed pomiarem (bufory list), ale wiersze list, CSR i zwarte
+        // macierze generator alokuje w trakcie pomiaru - pomiar pamieci jest wtedy wylaczony
+        std::thread generator;
+        int next_group, next_instance;
+        ahead_group = -1;
+        if(schedule.generate_ahead && followingTask(schedule, group_index, instance, next_group, next_instance)) {
+            const BenchmarkGroup* following = &schedule.groups[next_group];
+            ahead->prepare(following->vertices, following->kind != GRAPH_UNDIRECTED);
+            ahead_group = next_group;
+            ahead_instance = next_instance;
+            generator = std::thread([ahead, &schedule, following, next_group, next_instance]() {
+                generateInstance(*ahead, taskContext(schedule, next_group, next_instance), *following);
+            });
+        }
+        
+        for(int task = 0; task < task_count; task++) {
+            const AlgorithmInfo& algorithm = *schedule.cells[task_cells[task]].algorithm;
+            InstanceResult& result = results[task];
+            result = InstanceResult();
+            result.memory_build = memory_build;
+            result.build_measured = build_measured;
+            
+            if(group_index != last_group) {
+                for(int run = 0; run < schedule.warmup; run++) {
+                    for(int representation = 0; representation < REP_COUNT; representation++) {
+                        if(hasRepresentation(algorithm, representation)) algorithm.execute(*measured, representation, nullptr);
+                    }
+                }
+            }
+            
+            for(int representation = 0; representation < REP_COUNT; representation++) {
+                if(!hasRepresentation(algorithm, representation)) continue;
+                if(schedule.track_memory) memory.start();
+                lastRunStatistics().rounds = 0;
+                if(counters) counters->start();
+                result.time[representation] = algorithm.execute(*measured, representation, nullptr);
+                if(counters) {
+                    counters->stop();
+                    counters->accumulate(result.counters[representation]);
+                }
+                result.rounds[representation] = lastRunStatistics().rounds;
+                if(schedule.track_memory) result.memory_run[representation] = memory.stop();
+            }
+        }
+        last_group = group_index;
+        
+        if(options.verify) {
+            for(int task = 0; task < task_count; task++) {
+                VerificationContext check = ctx;
+                crossCheck(*measured, *schedule.cells[task_cells[task]].algorithm, check);
+                results[task].mismatches = check.mismatches;
+            }
+        }
+        
+        if(generator.joinable()) generator.join();
+        for(int task = 0; task < task_count; task++) finishTask(schedule, task_cells[task], results[task]);
+    }
+    
+    delete[] task_cells;
+    delete[] results;
+    delete counters;
+}
+
+static void printCellResults(const BenchmarkCell& cell, const BenchmarkSchedule& schedule, PerfCounters& counters) {
+    const AlgorithmInfo& algorithm = *cell.algorithm;
+    double total_time[REP_COUNT] = {0.0};
+    long long total_rounds[REP_COUNT] = {0};
+    int max_rounds[REP_COUNT] = {0};
+    long long counters_total[REP_COUNT][PERF_EVENT_COUNT] = {{0}};
+    MemoryUsage memory_build, memory_run[REP_COUNT];
+    int measured_builds = 0;
+    int cell_mismatches = 0;
+    
+    for(int test = 0; test < cell.done; test++) {
+        const InstanceResult& result = cell.results[test];
+        for(int representation = 0; representation < REP_COUNT; representation++) {
+            total_time[representation] += result.time[representation];
+            total_rounds[representation] += result.rounds[representation];
+            if(result.rounds[representation] > max_rounds[representation]) max_rounds[representation] = result.rounds[representation];
+            for(int e = 0; e < PERF_EVENT_COUNT; e++) counters_total[representation][e] += result.counters[representation][e];
+            memory_run[representation].add(result.memory_run[representation]);
+        }
+        if(result.build_measured) {
+            memory_build.add(result.memory_build);
+            measured_builds++;
+        }
+        cell_mismatches += result.mismatches;
+    }
+    
+    if(schedule.options->verify) {
+        std::cout << "zgodnosc wariantow: " << (cell_mismatches == 0 ? "OK" : "NIEZGODNOSCI = " + std::to_string(cell_mismatches)) << std::endl;
+    }
+    if(schedule.adaptive) {
+        static const char* stop_names[] = {"limit instancji", "przedzial ufnosci ponizej celu", "budzet czasu"};
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - cell.start;
+        std::cout << "instancji = " << cell.done << " (koniec: " << stop_names[cell.stop] << ", "
+                  << std::fixed << std::setprecision(1) << elapsed.count() << " s)" << std::endl;
+    }
+    if(schedule.track_memory && measured_builds > 0) printMemoryUsage("budowa grafu", memory_build, measured_builds);
+    std::cout << "szczytowa pamiec rezydentna procesu = " << std::fixed << std::setprecision(1)
+              << peakResidentKB() / 1024.0 << " MB" << std::endl;
+    std::cout << std::endl;
+    
+    for(int representation = 0; representation < REP_COUNT; representation++) {
+        if(!hasRepresentation(algorithm, representation)) continue;
+        std::cout << "algorytm = " << algorithm.name << " ilosc wierzcholkow = " << cell.vertices << " gestosc = " << cell.density
+                  << " reprezentacja = " << representationName(representation) << std::endl;
+        std::cout << "czas w sekundach = " << std::fixed << std::setprecision(6)
+                  << total_time[representation] / cell.done << std::endl;
+        
+        MedianInterval interval = cellInterval(cell, representation);
+        std::cout << "mediana = " << interval.median;
+        if(interval.valid) {
+            std::cout << ", 95% CI mediany = [" << interval.low << ", " << interval.high << "] (+-"
+                      << std::setprecision(1) << interval.relativeHalfWidth() * 100.0 << "%)" << std::endl;
+        } else {
+            std::cout << ", 95% CI mediany: za malo instancji" << std::endl;
+        }
+        if(total_rounds[representation] > 0) {
+            std::cout << "rundy relaksacji = " << std::setprecision(1) << (double)total_rounds[representation] / cell.done
+                      << " (najwiecej " << max_rounds[representation] << ")" << std::endl;
+        }
+        
+        if(schedule.collect_counters) counters.printAverages(counters_total[representation], cell.done);
+        if(schedule.track_memory) printMemoryUsage("pamiec algorytmu", memory_run[representation], cell.done);
+        std::cout << std::endl;
+    }
+}
+
+// Ocena zestawu wzgledem wzorca
+enum BaselineVerdict {
+    VERDICT_MISSING = 0,     // brak zestawu we wzorcu
+    VERDICT_UNCHANGED = 1,   // roznica nieistotna statystycznie lub mniejsza niz prog
+    VERDICT_FASTER = 2,
+    VERDICT_REGRESSION = 3,
+    VERDICT_INSUFFICIENT = 4 // za malo instancji, by test osiagnal poziom istotnosci
+};
+
+struct BaselineComparison {
+    const AlgorithmInfo* algorithm;
+    int representation;
+    int vertices;
+    int density;
+    double base_median;
+    double median;
+    double p_value;
+    int verdict;
+};
+
+// Regresja: mediana wolniejsza o wiecej niz prog i rozklady rozne w tescie Manna-Whitneya
+static BaselineComparison compareWithBaseline(const BenchmarkCell& cell, int representation, const double* times,
+                                              const Baseline& baseline, const BenchmarkOptions& options) {
+    BaselineComparison row;
+    row.algorithm = cell.algorithm;
+    row.representation = representation;
+    row.vertices = cell.vertices;
+    row.density = cell.density;
+    row.median = medianInterval(times, cell.done).median;
+    row.base_median = 0.0;
+    row.p_value = 1.0;
+    row.verdict = VERDICT_MISSING;
+    
+    const BaselineEntry* entry = baseline.find(cell.algorithm->name, representation, cell.vertices, cell.density);
+    if(!entry) return row;
+    
+    row.base_median = medianInterval(entry->times, entry->count).median;
+    row.p_value = mannWhitneyP(entry->times, entry->count, times, cell.done);
+    if(mannWhitneyMinP(entry->count, cell.done) >= options.significance) {
+        row.verdict = VERDICT_INSUFFICIENT;
+        return row;
+    }
+    row.verdict = VERDICT_UNCHANGED;
+    if(row.p_value < options.significance && row.base_median > 0.0) {
+        double ratio = row.median / row.base_median;
+        if(ratio > 1.0 + options.regression_threshold) row.verdict = VERDICT_REGRESSION;
+        else if(ratio < 1.0 - options.regression_threshold) row.verdict = VERDICT_FASTER;
+    }
+    return row;
+}
+
+static int printBaselineComparison(const BaselineComparison* rows, int count, const BenchmarkOptions& options) {
+    static const char* verdict_names[] = {"brak we wzorcu", "bez zmian", "szybciej", "REGRESJA",
+                                          "niewystarczajaca liczba probek"};
+    int regressions = 0;
+    int insufficient = 0;
+    
+    std::cout << "\n=== POROWNANIE ZE WZORCEM: " << options.compare_baseline << " ===" << std::endl;
+    std::cout << "(test Manna-Whitneya, p < " << std::defaultfloat << options.significance << ", prog zmiany mediany "
+              << std::fixed << std::setprecision(1) << options.regression_threshold * 100.0 << "%)" << std::endl;
+    std::cout << std::left << std::setw(18) << "algorytm" << std::setw(12) << "reprezent." << std::right
+              << std::setw(7) << "V" << std::setw(8) << "gestosc" << std::setw(14) << "wzorzec [s]"
+              << std::setw(14) << "teraz [s]" << std::setw(13) << "przyspiesz." << std::setw(10) << "p"
+              << "  ocena" << std::endl;
+    
+    for(int i = 0; i < count; i++) {
+        const BaselineComparison& row = rows[i];
+        std::cout << std::left << std::setw(18) << row.algorithm->name << std::setw(12) << representationName(row.representation)
+                  << std::right << std::setw(7) << row.vertices << std::setw(7) << row.density << "%";
+        if(row.verdict == VERDICT_MISSING) {
+            std::cout << std::setw(14) << "-" << std::setw(14) << std::setprecision(6) << row.median
+                      << std::setw(13) << "-" << std::setw(10) << "-";
+        } else {
+            std::cout << std::setw(14) << std::setprecision(6) << row.base_median << std::setw(14) << row.median
+                      << std::setw(12) << std::setprecision(3) << (row.median > 0.0 ? row.base_median / row.median : 0.0) << "x"
+                      << std::setw(10) << std::setprecision(4) << row.p_value;
+        }
+        std::cout << "  " << verdict_names[row.verdict] << std::endl;
+        if(row.verdict == VERDICT_REGRESSION) regressions++;
+        if(row.verdict == VERDICT_INSUFFICIENT) insufficient++;
+    }
+    
+    std::cout << "Regresji: " << regressions << std::endl;
+    if(insufficient > 0) {
+        std::cout << "Zestawow bez rozstrzygniecia (za malo instancji we wzorcu lub pomiarze): " << insufficient
+                  << " - potrzeba co najmniej " << mannWhitneyMinSamples(options.significance) << " instancji w obu" << std::endl;
+        if(regressions == 0) return -1;
+    }
+    return regressions;
+}
+
+int performPerformanceTests(const AlgorithmInfo* algorithm, const BenchmarkOptions& options) {
+    BenchmarkSchedule schedule;
+    schedule.options = &options;
+    schedule.adaptive = options.adaptive;
+    schedule.warmup = options.warmup >= 0 ? options.warmup : (options.adaptive ? 1 : 0);
+    schedule.collect_counters = options.collect_counters;
+    schedule.generate_ahead = options.generate_ahead;
+    schedule.pin_skip = options.reserve_core ? 1 : 0;
+    
+    int workers = options.workers;
+    if(workers <= 0) workers = defaultThreadCount() - schedule.pin_skip;
+    if(workers < 1) workers = 1;
+    
+    PerfCounters counters;
+    if(schedule.collect_counters && !counters.available()) {
+        std::cout << "Liczniki sprzetowe niedostepne (brak wsparcia systemu lub uprawnien) - tylko czasy" << std::endl;
+        schedule.collect_counters = false;
+    }
+    // Liczniki dziedzicza watki tworzone w trakcie pomiaru, wiec zliczalyby tez generator
+    if(schedule.collect_counters && schedule.generate_ahead) {
+        std::cout << "Generowanie w tle wylaczone - zaklocaloby liczniki sprzetowe" << std::endl;
+        schedule.generate_ahead = false;
+    }
+    // W trybie adaptacyjnym nie wiadomo z gory, czy zestaw potrzebuje kolejnej instancji
+    if(schedule.generate_ahead && (workers > 1 || schedule.adaptive || std::thread::hardware_concurrency() < 2)) {
+        std::cout << "Generowanie w tle wylaczone - wymaga trybu szeregowego, stalej liczby instancji"
+                  << " i co najmniej dwoch rdzeni" << std::endl;
+        schedule.generate_ahead = false;
+    }
+    // Liczniki alokacji sa wspolne dla procesu - przy wielu watkach lub generatorze w tle
+    // mieszalyby pomiary
+    schedule.track_memory = (workers == 1 && !schedule.generate_ahead);
+    
+    Baseline reference, recorded;
+    if(!options.compare_baseline.empty()) {
+        if(!reference.load(options.compare_baseline)) return -1;
+        std::cout << "Wzorzec " << options.compare_baseline << ": " << reference.size() << " zestawow" << std::endl;
+    }
+    
+    // Kazda instancja generowana z wlasnego ziarna - niezgodnosci mozna odtworzyc.
+    // Przy porownaniu mierzone sa te same instancje co we wzorcu.
+    schedule.base_seed = reference.hasSeed() ? reference.getSeed() : (unsigned int)time(nullptr);
+    recorded.setSeed(schedule.base_seed);
+    if(options.verify) {
+        std::cout << "Weryfikacja wariantow wlaczona, ziarno bazowe = " << schedule.base_seed << std::endl;
+    }
+    if(workers > 1) {
+        std::cout << "Tryb rownolegly: " << workers << " watkow pomiarowych (jedna instancja na watek)"
+                  << ", pomiar pamieci wylaczony" << std::endl;
+    }
+    if(schedule.generate_ahead) {
+        std::cout << "Generowanie kolejnej instancji w tle podczas pomiaru, pomiar pamieci wylaczony" << std::endl;
+    }
+    
+    // Przeglad skalowania: rozmiary w postepie geometrycznym i wlasne gestosci
+    // zamiast rozmiarow z wymagan
+    const int* densities = test_densities;
+    int num_densities = NUM_DENSITIES;
+    int* sweep_sizes = nullptr;
+    int num_sweep_sizes = 0;
+    if(options.sweep) {
+        densities = options.sweep_densities;
+        num_densities = options.sweep_density_count;
+        double factor = options.sweep_factor > 1.01 ? options.sweep_factor : 1.01;
+        for(double v = options.sweep_min_vertices; v <= options.sweep_max_vertices + 0.5; v *= factor) {
+            num_sweep_sizes++;
+        }
+        sweep_sizes = new int[num_sweep_sizes > 0 ? num_sweep_sizes : 1];
+        num_sweep_sizes = 0;
+        for(double v = options.sweep_min_vertices; v <= options.sweep_max_vertices + 0.5; v *= factor) {
+            int vertices = (int)(v + 0.5);
+            if(vertices < 2) continue;
+            if(num_sweep_sizes == 0 || sweep_sizes[num_sweep_sizes - 1] != vertices) sweep_sizes[num_sweep_sizes++] = vertices;
+        }
+    }
+    
+    int baseline_samples = 0;
+    if(!options.compare_baseline.empty() || !options.save_baseline.empty()) {
+        baseline_samples = mannWhitneyMinSamples(options.significance);
+        std::cout << "Wzorzec: co najmniej " << baseline_samples << " instancji na zestaw (test Manna-Whitneya, p < "
+                  << std::defaultfloat << options.significance << ")" << std::endl;
+    }
+    
+    // Wszystkie zestawy wybranych algorytmow
+    int num_cells = 0;
+    for(int index = 0; index < algorithmCount(); index++) {
+        const AlgorithmInfo& current = algorithmAt(index);
+        if(algorithm && algorithm != &current) continue;
+        num_cells += (options.sweep ? num_sweep_sizes : current.num_sizes) * num_densities;
+    }
+    BenchmarkCell* cells = new BenchmarkCell[num_cells];
+    num_cells = 0;
+    for(int index = 0; index < algorithmCount(); index++) {
+        const AlgorithmInfo& current = algorithmAt(index);
+        if(algorithm && algorithm != &current) continue;
+        
+        // Tryb staly: liczba instancji z wymagan; adaptacyjny: od min_tests do limitu
+        int max_tests = schedule.adaptive ? ADAPTIVE_MAX_TESTS : current.num_tests;
+        if(options.max_tests > 0 && options.max_tests < max_tests) max_tests = options.max_tests;
+        if(max_tests > SEED_STRIDE) max_tests = SEED_STRIDE;
+        // Wzorzec i porownanie wymagaja serii, na ktorych test Manna-Whitneya cos rozstrzyga
+        if(baseline_samples > max_tests) max_tests = baseline_samples;
+        int min_tests = schedule.adaptive ? options.min_tests : max_tests;
+        if(min_tests < baseline_samples) min_tests = baseline_samples;
+        if(min_tests < 1) min_tests = 1;
+        if(min_tests > max_tests) min_tests = max_tests;
+        
+        int num_sizes = options.sweep ? num_sweep_sizes : current.num_sizes;
+        for(int size_idx = 0; size_idx < num_sizes; size_idx++) {
+            for(int dens_idx = 0; dens_idx < num_densities; dens_idx++) {
+                BenchmarkCell& cell = cells[num_cells++];
+                cell.algorithm = &current;
+                cell.group = -1;
+                cell.vertices = options.sweep ? sweep_sizes[size_idx] : current.test_sizes[size_idx];
+                cell.density = densities[dens_idx];
+                cell.min_tests = min_tests;
+                cell.max_tests = max_tests;
+                cell.issued = 0;
+                cell.done = 0;
+                cell.closed = false;
+                cell.stop = STOP_LIMIT;
+                cell.results = nullptr;
+            }
+        }
+    }
+    
+    // Grupy w kolejnosci pierwszego wystapienia: zestawy o tym samym rodzaju grafu,
+    // rozmiarze i gestosci (rozne algorytmy) dziela instancje
+    BenchmarkGroup* groups = new BenchmarkGroup[num_cells];
+    int num_groups = 0;
+    for(int c = 0; c < num_cells; c++) {
+        if(cells[c].group >= 0) continue;
+        BenchmarkGroup& group = groups[num_groups];
+        group.kind = cells[c].algorithm->kind;
+        group.vertices = cells[c].vertices;
+        group.density = cells[c].density;
+        group.representations = 0;
+        group.max_tests = 0;
+        group.cells = new int[algorithmCount()];
+        group.num_cells = 0;
+        group.issued = 0;
+        for(int other = c; other < num_cells; other++) {
+            BenchmarkCell& cell = cells[other];
+            if(cell.group >= 0 || cell.algorithm->kind != group.kind || cell.vertices != group.vertices
+               || cell.density != group.density) continue;
+            cell.group = num_groups;
+            group.cells[group.num_cells++] = other;
+            group.representations |= cell.algorithm->representations;
+            if(cell.max_tests > group.max_tests) group.max_tests = cell.max_tests;
+        }
+        num_groups++;
+    }
+    
+    schedule.cells = cells;
+    schedule.num_cells = num_cells;
+    schedule.groups = groups;
+    schedule.num_groups = num_groups;
+    schedule.current_group = 0;
+    schedule.pinned_workers = 0;
+    
+    BaselineComparison* comparisons = new BaselineComparison[num_cells * REP_COUNT];
+    int comparison_count = 0;
+    ScalingPoint* scaling = options.sweep ? new ScalingPoint[num_cells * REP_COUNT] : nullptr;
+    int algorithm_first_cell = 0;
+    
+    std::thread* threads = new std::thread[workers];
+    for(int t = 0; t < workers; t++) {
+        threads[t] = std::thread(benchmarkWorker, std::ref(schedule), t);
+    }
+    
+    // Watek glowny wypisuje zestawy w kolejnosci, gdy wszystkie ich instancje sa gotowe
+    for(int c = 0; c < num_cells; c++) {
+        BenchmarkCell& cell = cells[c];
+        if(c == 0 || cells[c - 1].algorithm != cell.algorithm) {
+            algorithm_first_cell = c;
+            std::cout << "\n=== TESTY WYDAJNOSCI: " << cell.algorithm->title << " ===" << std::endl;
+            std::cout << "- " << (options.sweep ? num_sweep_sizes : cell.algorithm->num_sizes) << " rozmiarow grafow";
+            if(options.sweep) {
+                std::cout << " (przeglad " << sweep_sizes[0] << " - " << sweep_sizes[num_sweep_sizes - 1] << ")";
+            }
+            std::cout << std::endl;
+            std::cout << "- " << num_densities << " gestosci:";
+            for(int d = 0; d < num_densities; d++) std::cout << (d == 0 ? " " : ", ") << densities[d] << "%";
+            std::cout << std::endl;
+            if(schedule.adaptive) {
+                std::cout << "- od " << cell.min_tests << " do " << cell.max_tests << " instancji na zestaw, do 95% CI mediany +-"
+                          << std::fixed << std::setprecision(1) << options.target_ci * 100.0 << "% lub "
+                          << options.time_budget << " s na zestaw" << std::endl;
+            } else {
+                std::cout << "- " << cell.max_tests << " instancji dla kazdego zestawu" << std::endl;
+            }
+            if(schedule.warmup > 0) {
+                std::cout << "- " << schedule.warmup << " przebiegow rozgrzewkowych przed pomiarem zestawu" << std::endl;
+            }
+            std::cout << "- Wyniki usrednione\n" << std::endl;
+        }
+        
+        std::cout << "Testowanie " << cell.vertices << " wierzcholkow, gestosc " << cell.density << "%... ";
+        std::cout.flush();
+        {
+            std::unique_lock<std::mutex> guard(schedule.lock);
+            schedule.finished.wait(guard, [&cell]() { return cell.complete(); });
+        }
+        std::cout << "GOTOWE" << std::endl;
+        printCellResults(cell, schedule, counters);
+        
+        double* times = new double[cell.done];
+        for(int representation = 0; representation < REP_COUNT; representation++) {
+            if(!hasRepresentation(*cell.algorithm, representation)) continue;
+            cellTimes(cell, representation, times);
+            if(!options.save_baseline.empty()) {
+                recorded.add(cell.algorithm->name, representation, cell.vertices, cell.density, times, cell.done);
+            }
+            if(!options.compare_baseline.empty()) {
+                comparisons[comparison_count++] = compareWithBaseline(cell, representation, times, reference, options);
+            }
+        }
+        if(scaling) {
+            for(int representation = 0; representation < REP_COUNT; representation++) {
+                ScalingPoint& point = scaling[c * REP_COUNT + representation];
+                point.vertices = cell.vertices;
+                point.density = cell.density;
+                point.edges = generatedEdgeCount(cell.vertices, cell.density, cell.algorithm->kind != GRAPH_UNDIRECTED);
+                point.time = hasRepresentation(*cell.algorithm, representation) ? cellInterval(cell, representation).median : 0.0;
+            }
+            if(c + 1 == num_cells || cells[c + 1].algorithm != cell.algorithm) {
+                printScalingReport(*cell.algorithm, scaling + algorithm_first_cell * REP_COUNT, c + 1 - algorithm_first_cell,
+                                   densities, num_densities);
+            }
+        }
+        delete[] times;
+        delete[] cell.results;
+        cell.results = nullptr;
+    }
+    
+    for(int t = 0; t < workers; t++) {
+        threads[t].join();
+    }
+    if(options.pin_workers) {
+        std::cout << "Watki przypiete do rdzeni: " << schedule.pinned_workers << " z " << workers << std::endl;
+    }
+    
+    int regressions = 0;
+    if(!options.compare_baseline.empty()) {
+        regressions = printBaselineComparison(comparisons, comparison_count, options);
+    }
+    if(!options.save_baseline.empty() && recorded.save(options.save_baseline)) {
+        std::cout << "Zapisano wzorzec: " << options.save_baseline << " (" << recorded.size() << " zestawow)" << std::endl;
+    }
+    
+    delete[] comparisons;
+    delete[] scaling;
+    delete[] sweep_sizes;
+    delete[] threads;
+    for(int g = 0; g < num_groups; g++) delete[] groups[g].cells;
+    delete[] groups;
+    delete[] cells;
+    std::cout << "=== KONIEC TESTOW WYDAJNOSCI ===" << std::endl;
+    return regressions;
+}
+
+// Wplyw numeracji na czas: kazda instancja mierzona we wszystkich numeracjach
+void reorderingBenchmark(Graph& graph, const AlgorithmInfo& algorithm) {
+    int v, density, num_tests;
+    std::cout << "Podaj liczbe wierzcholkow: ";
+    std::cin >> v;
+    std::cout << "Podaj gestosc grafu (w %): ";
+    std::cin >> density;
+    std::cout << "Podaj liczbe instancji: ";
+    std::cin >> num_tests;
+    if(v <= 1 || num_tests <= 0) return;
+    
+    const int num_orderings = 4;
+    double total_time[num_orderings][REP_COUNT] = {{0.0}};
+    double total_gap[num_orderings] = {0.0};
+    long long total_band[num_orderings] = {0};
+    long long counters_total[num_orderings][REP_COUNT][PERF_EVENT_COUNT] = {{{0}}};
+    PerfCounters counters;
+    bool collect_counters = counters.available();
+    
+    for(int test = 0; test < num_tests; test++) {
+        graph.generateRandomForTesting(v, density, algorithm.kind);
+        
+        for(int ordering = 0; ordering < num_orderings; ordering++) {
+            // Kazda numeracja liczona od numeracji wejsciowej
+            graph.applyOrdering(ORDER_ORIGINAL);
+            if(ordering != ORDER_ORIGINAL) graph.applyOrdering(ordering);
+            
+            double gap;
+            int band;
+            orderingLocality(graph.getVertices(), graph.getList(), graph.getListSizes(), 2, gap, band);
+            total_gap[ordering] += gap;
+            total_band[ordering] += band;
+            
+            for(int representation = 0; representation < REP_COUNT; representation++) {
+                if(!hasRepresentation(algorithm, representation)) continue;
+                if(collect_counters) counters.start();
+                total_time[ordering][representation] += algorithm.execute(graph, representation, nullptr);
+                if(collect_counters) {
+                    counters.stop();
+                    counters.accumulate(counters_total[ordering][representation]);
+                }
+            }
+        }
+    }
+    
+    std::cout << "\nalgorytm = " << algorithm.name << " ilosc wierzcholkow = " << v << " gestosc = " << density
+              << " instancji = " << num_tests << std::endl;
+    for(int ordering = 0; ordering < num_orderings; ordering++) {
+        std::cout << "numeracja = " << orderingName(ordering) << std::endl;
+        std::cout << "srednia odleglosc sasiadow = " << std::fixed << std::setprecision(1) << total_gap[ordering] / num_tests
+                  << " szerokosc pasma = " << total_band[ordering] / num_tests << std::endl;
+        for(int representation = 0; representation < REP_COUNT; representation++) {
+            if(!hasRepresentation(algorithm, representation)) continue;
+            std::cout << "czas w sekundach (" << representationName(representation) << ") = " << std::setprecision(6)
+                      << total_time[ordering][representation] / num_tests << std::endl;
+            if(collect_counters) counters.printAverages(counters_total[ordering][representation], num_tests);
+        }
+        std::cout << std::endl;
+    }
+}
+
+// Jeden graf na ziarno i rodzaj grafu - wspolny dla wszystkich wybranych algorytmow tego rodzaju
+void runVerification(Graph& graph, const AlgorithmInfo* algorithm) {
+    runFuzzing([&graph, algorithm](VerificationContext& ctx) {
+        for(int kind = GRAPH_UNDIRECTED; kind <= GRAPH_DIRECTED_NEGATIVE; kind++) {
+            bool generated = false;
+            for(int index = 0; index < algorithmCount(); index++) {
+                const AlgorithmInfo& current = algorithmAt(index);
+                if(current.kind != kind || (algorithm && algorithm != &current)) continue;
+                if(!generated) {
+                    graph.generateRandomForTesting(ctx.vertices, ctx.density, kind, ctx.seed);
+                    generated = true;
+                }
+                crossCheck(graph, current, ctx);
+            }
+        }
+    });
+}
@@ -0,0 +1,67 @@
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include "Algorithms.h"
+#include <string>
+
+// Testy wydajnosci i weryfikacja sterowane opisem algorytmu z rejestru.
+// algorithm == nullptr oznacza wszystkie zarejestrowane algorytmy.
+
+const int MAX_SWEEP_DENSITIES = 8;
+
+struct BenchmarkOptions {
+    bool collect_counters; // sprzetowe liczniki wydajnosci
+    bool verify;           // sprawdzanie zgodnosci wszystkich wariantow
+    bool generate_ahead;   // kolejna instancja generowana w tle podczas pomiaru biezacej
+    int max_tests;         // > 0 - najwyzej tyle instancji na zestaw (np. krotki trening PGO)
+    int workers;           // watki pomiarowe: 1 - szeregowo, 0 - wszystkie rdzenie
+    bool pin_workers;      // przypiecie kazdego watku pomiarowego do osobnego rdzenia
+    bool reserve_core;     // pierwszy rdzen pozostawiony systemowi i watkowi glownemu
+    bool adaptive;         // liczba instancji wg przedzialu ufnosci mediany zamiast stalej z wymagan
+    double target_ci;      // docelowa polowa szerokosci 95% CI mediany wzgledem mediany (0.05 = +-5%)
+    double time_budget;    // budzet czasu na zestaw w sekundach (tryb adaptacyjny)
+    int min_tests;         // najmniej instancji na zestaw w trybie adaptacyjnym
+    int warmup;            // przebiegi rozgrzewkowe na zestaw; -1 - 1 w trybie adaptacyjnym, 0 w stalym
+    std::string save_baseline;    // plik, do ktorego zapisac czasy wszystkich instancji jako wzorzec
+    std::string compare_baseline; // plik wzorca, z ktorym porownac biezace wyniki
+    double regression_threshold;  // zmiana mediany uznawana za istotna praktycznie (0.05 = 5%)
+    double significance;          // poziom istotnosci testu Manna-Whitneya
+    bool sweep;                   // przeglad skalowania zamiast rozmiarow z wymagan
+    int sweep_min_vertices;       // rozmiary od min do max w postepie geometrycznym
+    int sweep_max_vertices;
+    double sweep_factor;
+    int sweep_densities[MAX_SWEEP_DENSITIES];
+    int sweep_density_count;
+    
+    BenchmarkOptions() : collect_counters(false), verify(false), generate_ahead(false), max_tests(0),
+                         workers(1), pin_workers(false), reserve_core(false), adaptive(false),
+                         target_ci(0.05), time_budget(30.0), min_tests(6), warmup(-1),
+                         regression_threshold(0.05), significance(0.01), sweep(false),
+                         sweep_min_vertices(50), sweep_max_vertices(800), sweep_factor(2.0), sweep_density_count(5) {
+        static const int default_densities[] = {10, 25, 50, 75, 99};
+        for(int i = 0; i < sweep_density_count; i++) sweep_densities[i] = default_densities[i];
+    }
+};
+
+// Instancje generuja watki pomiarowe we wlasnych grafach (graf wczytany w menu nie jest
+// uzywany ani zmieniany). Instancje sa niezalezne (kazda z wlasnego ziarna), wiec przy
+// workers != 1 mierzone sa rownolegle po jednej na watek; wyniki laczone w ramach zestawu.
+// W trybie przegladu (sweep) po kazdym algorytmie wypisywane jest dopasowanie modeli
+// zlozonosci i przeciecia reprezentacji (Scaling.h).
+// Przy zapisie lub porownaniu wzorca zestawy maja co najmniej tyle instancji, ile wymaga
+// test Manna-Whitneya na zadanym poziomie istotnosci.
+// Zwraca liczbe regresji wzgledem wzorca (0 bez porownania) lub -1, gdy wzorca nie wczytano
+// albo (bez regresji) czesc zestawow nie dala sie rozstrzygnac z braku instancji.
+int performPerformanceTests(const AlgorithmInfo* algorithm, const BenchmarkOptions& options);
+
+// Wplyw numeracji wierzcholkow na czas wszystkich reprezentacji algorytmu
+void reorderingBenchmark(Graph& graph, const AlgorithmInfo& algorithm);
+
+// Porownanie wszystkich wariantow algorytmu na biezacym grafie (reprezentacje,
+// numeracje wierzcholkow i dodatkowe silniki). Numeracja grafu jest na koniec przywracana.
+void crossCheck(Graph& graph, const AlgorithmInfo& algorithm, VerificationContext& ctx);
+
+// Weryfikacja na losowych grafach generowanych z kolejnych ziaren
+void runVerification(Graph& graph, const AlgorithmInfo* algorithm);
+
+#endif
@@ -0,0 +1,148 @@
+#include "CostModel.h"
+#include "Baseline.h"
+#include "Statistics.h"
+#include <iostream>
+#include <iomanip>
+
+// Bez kalibracji: reprezentacja macierzowa dopiero dla prawie pelnych grafow
+static const double DENSE_THRESHOLD = 0.9;
+
+CostModel::CostModel() {
+    for(int i = 0; i < MAX_ENGINES; i++) {
+        calibrated[i] = false;
+    }
+}
+
+int CostModel::engineIndex(const AlgorithmInfo& algorithm, int representation) {
+    for(int index = 0; index < algorithmCount(); index++) {
+        if(&algorithmAt(index) == &algorithm) return index * REP_COUNT + representation;
+    }
+    return -1;
+}
+
+bool CostModel::load(const std::string& filename) {
+    Baseline results;
+    if(!results.load(filename)) return false;
+    
+    ScalingPoint* points = new ScalingPoint[results.size() > 0 ? results.size() : 1];
+    for(int index = 0; index < algorithmCount(); index++) {
+        const AlgorithmInfo& algorithm = algorithmAt(index);
+        bool directed = algorithm.kind != GRAPH_UNDIRECTED;
+        
+        for(int representation = 0; representation < REP_COUNT; representation++) {
+            int count = 0;
+            for(int i = 0; i < results.size(); i++) {
+                const BaselineEntry& entry = results.at(i);
+                if(entry.representation != representation || entry.algorithm != algorithm.name) continue;
+                ScalingPoint& point = points[count++];
+                point.vertices = entry.vertices;
+                point.density = entry.density;
+                point.edges = generatedEdgeCount(entry.vertices, entry.density, directed);
+                point.time = medianInterval(entry.times, entry.count).median;
+            }
+            // Dwa parametry modelu - potrzeba co najmniej trzech zestawow
+            if(count < 3) continue;
+            
+            int engine = index * REP_COUNT + representation;
+            for(int model = 0; model < MODEL_COUNT; model++) {
+                ComplexityFit candidate = fitComplexity(points, count, 1, model);
+                if(!calibrated[engine] || candidate.error < fits[engine].error) {
+                    fits[engine] = candidate;
+                    calibrated[engine] = true;
+                }
+            }
+        }
+    }
+    delete[] points;
+    return true;
+}
+
+bool CostModel::isCalibrated(const AlgorithmInfo& algorithm, int representation) const {
+    int engine = engineIndex(algorithm, representation);
+    return engine >= 0 && calibrated[engine];
+}
+
+double CostModel::predict(const AlgorithmInfo& algorithm, int representation, int vertices, long long edges) const {
+    if(!isCalibrated(algorithm, representation)) return -1.0;
+    return predictComplexity(fits[engineIndex(algorithm, representation)], vertices, (double)edges);
+}
+
+const ComplexityFit& CostModel::fit(const AlgorithmInfo& algorithm, int representation) const {
+    return fits[engineIndex(algorithm, representation)];
+}
+
+// Te same warunki co acceptsGraph, bez komunikatow
+static bool supportsGraph(const AlgorithmInfo& algorithm, const Graph& graph) {
+    if((algorithm.kind != GRAPH_UNDIRECTED) != graph.isDirected()) return false;
+    if(algorithm.shortest_paths && !graph.distancesFitInt()) return false;
+    return !graph.hasNegativeWeights() || algorithm.kind == GRAPH_DIRECTED_NEGATIVE;
+}
+
+// Regula bez kalibracji: Prim dla MST, Dijkstra (z kopcem w grafie rzadkim, lub Bellman-Ford
+// przy ujemnych wagach) dla najkrotszych sciezek, a gdy ich nie ma - pierwszy obslugujacy algorytm
+static EngineChoice fallbackChoice(const Graph& graph, bool shortest_paths, double density) {
+    bool dense = density >= DENSE_THRESHOLD;
+    const char* preferred[] = {"prim", dense ? "dijkstra" : "dijkstra-heap", "dijkstra", "bellman-ford"};
+    EngineChoice choice;
+    choice.algorithm = nullptr;
+    choice.representation = dense ? REP_MATRIX : REP_LIST;
+    choice.predicted = -1.0;
+    
+    for(int i = 0; i < 4 && !choice.algorithm; i++) {
+        const AlgorithmInfo* algorithm = findAlgorithm(preferred[i]);
+        if(algorithm && algorithm->shortest_paths == shortest_paths && supportsGraph(*algorithm, graph)) choice.algorithm = algorithm;
+    }
+    for(int index = 0; index < algorithmCount() && !choice.algorithm; index++) {
+        const AlgorithmInfo& algorithm = algorithmAt(index);
+        if(algorithm.shortest_paths == shortest_paths && supportsGraph(algorithm, graph)) choice.algorithm = &algorithm;
+    }
+    if(choice.algorithm && !(choice.algorithm->representations & (1 << choice.representation))) {
+        choice.representation = choice.representation == REP_MATRIX ? REP_LIST : REP_MATRIX;
+    }
+    return choice;
+}
+
+EngineChoice chooseEngine(const CostModel& model, const Graph& graph, bool shortest_paths) {
+    int vertices = graph.getVertices();
+    long long edges = graph.getEdgeCount();
+    long long max_edges = (long long)vertices * (vertices - 1);
+    if(!graph.isDirected()) max_edges /= 2;
+    double density = max_edges > 0 ? (double)edges / max_edges : 0.0;
+    
+    std::cout << "Graf: V = " << vertices << ", E = " << edges << ", gestosc = " << std::fixed << std::setprecision(1)
+              << density * 100.0 << "%, wagi " << (graph.hasNegativeWeights() ? "z ujemnymi" : "nieujemne") << std::endl;
+    
+    EngineChoice choice;
+    choice.algorithm = nullptr;
+    choice.representation = REP_MATRIX;
+    choice.predicted = -1.0;
+    
+    for(int index = 0; index < algorithmCount(); index++) {
+        const AlgorithmInfo& algorithm = algorithmAt(index);
+        if(algorithm.shortest_paths != shortest_paths || !supportsGraph(algorithm, graph)) continue;
+        
+        for(int representation = 0; representation < REP_COUNT; representation++) {
+            if(!(algorithm.representations & (1 << representation))) continue;
+            double predicted = model.predict(algorithm, representation, vertices, edges);
+            std::cout << "  " << std::left << std::setw(18) << algorithm.name << std::setw(12) << representationName(representation)
+                      << std::right;
+            if(predicted < 0.0) {
+                std::cout << "brak kalibracji" << std::endl;
+                continue;
+            }
+            std::cout << "przewidywany czas = " << std::setprecision(6) << predicted << " s (model "
+                      << complexityModelName(model.fit(algorithm, representation).model) << ")" << std::endl;
+            if(!choice.algorithm || predicted < choice.predicted) {
+                choice.algorithm = &algorithm;
+                choice.representation = representation;
+                choice.predicted = predicted;
+            }
+        }
+    }
+    
+    if(!choice.algorithm) {
+        std::cout << "Brak kalibracji (" << COST_MODEL_FILE << ") - wybor wg gestosci" << std::endl;
+        choice = fallbackChoice(graph, shortest_paths, density);
+    }
+    return choice;
+}
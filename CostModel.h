@@ -0,0 +1,47 @@
+#ifndef COSTMODEL_H
+#define COSTMODEL_H
+
+#include "Algorithms.h"
+#include "Scaling.h"
+#include <string>
+
+// Model kosztu silnikow (algorytm x reprezentacja) skalibrowany z zapisanych wynikow
+// testow wydajnosci na tej maszynie: dla kazdego silnika najlepiej dopasowany model
+// zlozonosci z pliku wzorca (Baseline.h). Tryb "automatycznie" wybiera silnik
+// o najmniejszym przewidywanym czasie dla V i E biezacego grafu.
+//
+// Kalibracja: aizo_bench all --calibrate (przeglad skalowania zapisany do COST_MODEL_FILE).
+
+const char* const COST_MODEL_FILE = "aizo_costmodel.txt";
+
+class CostModel {
+private:
+    static const int MAX_ENGINES = 32 * REP_COUNT;
+    ComplexityFit fits[MAX_ENGINES];
+    bool calibrated[MAX_ENGINES];
+    
+    static int engineIndex(const AlgorithmInfo& algorithm, int representation);
+    
+public:
+    CostModel();
+    
+    // Dopasowanie modeli do wszystkich zestawow pliku; false, gdy pliku nie wczytano
+    bool load(const std::string& filename);
+    bool isCalibrated(const AlgorithmInfo& algorithm, int representation) const;
+    // Przewidywany czas w sekundach; < 0 - silnik nieskalibrowany
+    double predict(const AlgorithmInfo& algorithm, int representation, int vertices, long long edges) const;
+    const ComplexityFit& fit(const AlgorithmInfo& algorithm, int representation) const;
+};
+
+struct EngineChoice {
+    const AlgorithmInfo* algorithm;
+    int representation;
+    double predicted; // < 0 - wybor regula gestosci (brak kalibracji)
+};
+
+// Wybor silnika dla problemu algorytmu (MST lub najkrotsze sciezki) sposrod algorytmow,
+// ktore obsluguja graf (skierowanie, znak wag). Wypisuje przewidywania kandydatow.
+// algorithm == nullptr w wyniku - zaden algorytm nie obsluguje grafu.
+EngineChoice chooseEngine(const CostModel& model, const Graph& graph, bool shortest_paths);
+
+#endif
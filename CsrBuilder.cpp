@@ -0,0 +1,182 @@
+#include "CsrBuilder.h"
+#include "Parallel.h"
+
+// Ponizej tej liczby krawedzi uruchomienie watkow kosztuje wiecej niz budowa
+static const int PARALLEL_EDGE_THRESHOLD = 1 << 16;
+
+// Zadania na watek przy pracy po wierszach (wyrownanie wierszy o roznych stopniach)
+static const int ROW_TASKS_PER_THREAD = 8;
+
+// Przedzial [first, last) czesci part z parts rownych czesci zakresu [0, count)
+static void chunkRange(int count, int parts, int part, int& first, int& last) {
+    first = (int)((long long)count * part / parts);
+    last = (int)((long long)count * (part + 1) / parts);
+}
+
+// Sortowanie przez kopcowanie wiersza wg numeru sasiada (wagi przestawiane razem z nim)
+static void sortRow(int* targets, int* weights, int count) {
+    auto swapEntries = [&](int a, int b) {
+        int target = targets[a];
+        targets[a] = targets[b];
+        targets[b] = target;
+        int weight = weights[a];
+        weights[a] = weights[b];
+        weights[b] = weight;
+    };
+    auto siftDown = [&](int i, int n) {
+        while(true) {
+            int largest = i;
+            int left = 2 * i + 1;
+            int right = 2 * i + 2;
+            if(left < n && targets[left] > targets[largest]) largest = left;
+            if(right < n && targets[right] > targets[largest]) largest = right;
+            if(largest == i) return;
+            swapEntries(i, largest);
+            i = largest;
+        }
+    };
+    
+    for(int i = count / 2 - 1; i >= 0; i--) siftDown(i, count);
+    for(int end = count - 1; end > 0; end--) {
+        swapEntries(0, end);
+        siftDown(0, end);
+    }
+}
+
+// Scalanie sasiednich powtorzen posortowanego wiersza (najmniejsza waga); zwraca nowa dlugosc
+static int mergeDuplicates(int* targets, int* weights, int count) {
+    int kept = 0;
+    for(int i = 0; i < count; i++) {
+        if(kept > 0 && targets[kept - 1] == targets[i]) {
+            if(weights[i] < weights[kept - 1]) weights[kept - 1] = weights[i];
+            continue;
+        }
+        targets[kept] = targets[i];
+        weights[kept] = weights[i];
+        kept++;
+    }
+    return kept;
+}
+
+int csrThreadCount(int edge_count, int num_threads) {
+    if(edge_count < PARALLEL_EDGE_THRESHOLD) return 1;
+    return num_threads < 1 ? defaultThreadCount() : num_threads;
+}
+
+CsrArrays buildCsrFromEdges(const Edge* edges, int edge_count, int vertices, bool symmetric, int flags, int num_threads) {
+    num_threads = csrThreadCount(edge_count, num_threads);
+    int parts = num_threads;
+    int row_tasks = num_threads > 1 ? num_threads * ROW_TASKS_PER_THREAD : 1;
+    
+    CsrArrays csr;
+    csr.offsets = new int[vertices + 1];
+    csr.removed = 0;
+    
+    // 1. Stopnie: counts[part * vertices + v] - liczba wpisow wiersza v z fragmentu part
+    int* counts = new int[(size_t)parts * vertices];
+    parallelFor(parts, num_threads, [&](int part, int) {
+        int* count = counts + (size_t)part * vertices;
+        for(int v = 0; v < vertices; v++) count[v] = 0;
+        int first, last;
+        chunkRange(edge_count, parts, part, first, last);
+        for(int e = first; e < last; e++) {
+            count[edges[e].start]++;
+            if(symmetric) count[edges[e].end]++;
+        }
+    });
+    
+    // 2. Sumy prefiksowe: dlugosci wierszy, poczatki wierszy, a w counts miejsce,
+    //    od ktorego fragment part wpisuje sie do wiersza v
+    parallelFor(row_tasks, num_threads, [&](int task, int) {
+        int first, last;
+        chunkRange(vertices, row_tasks, task, first, last);
+        for(int v = first; v < last; v++) {
+            int total = 0;
+            for(int part = 0; part < parts; part++) total += counts[(size_t)part * vertices + v];
+            csr.offsets[v + 1] = total;
+        }
+    });
+    csr.offsets[0] = 0;
+    for(int v = 0; v < vertices; v++) csr.offsets[v + 1] += csr.offsets[v];
+    parallelFor(row_tasks, num_threads, [&](int task, int) {
+        int first, last;
+        chunkRange(vertices, row_tasks, task, first, last);
+        for(int v = first; v < last; v++) {
+            int position = csr.offsets[v];
+            for(int part = 0; part < parts; part++) {
+                int count = counts[(size_t)part * vertices + v];
+                counts[(size_t)part * vertices + v] = position;
+                position += count;
+            }
+        }
+    });
+    
+    // 3. Rozproszenie - kazdy fragment pisze tylko w swoje miejsca wierszy
+    int total = csr.offsets[vertices];
+    csr.targets = new int[total];
+    csr.weights = new int[total];
+    parallelFor(parts, num_threads, [&](int part, int) {
+        int* position = counts + (size_t)part * vertices;
+        int first, last;
+        chunkRange(edge_count, parts, part, first, last);
+        for(int e = first; e < last; e++) {
+            const Edge& edge = edges[e];
+            int pos = position[edge.start]++;
+            csr.targets[pos] = edge.end;
+            csr.weights[pos] = edge.weight;
+            if(symmetric) {
+                pos = position[edge.end]++;
+                csr.targets[pos] = edge.start;
+                csr.weights[pos] = edge.weight;
+            }
+        }
+    });
+    delete[] counts;
+    
+    if(!(flags & (CSR_SORT_ROWS | CSR_REMOVE_DUPLICATES))) return csr;
+    
+    // 4. Sortowanie wierszy i scalanie duplikatow w miejscu; kept - nowe dlugosci wierszy
+    bool merge = (flags & CSR_REMOVE_DUPLICATES) != 0;
+    int* kept = merge ? new int[vertices + 1] : nullptr;
+    parallelFor(row_tasks, num_threads, [&](int task, int) {
+        int first, last;
+        chunkRange(vertices, row_tasks, task, first, last);
+        for(int v = first; v < last; v++) {
+            int begin = csr.offsets[v];
+            int length = csr.offsets[v + 1] - begin;
+            sortRow(csr.targets + begin, csr.weights + begin, length);
+            if(merge) kept[v + 1] = mergeDuplicates(csr.targets + begin, csr.weights + begin, length);
+        }
+    });
+    if(!merge) return csr;
+    
+    kept[0] = 0;
+    for(int v = 0; v < vertices; v++) kept[v + 1] += kept[v];
+    csr.removed = total - kept[vertices];
+    if(csr.removed == 0) {
+        delete[] kept;
+        return csr;
+    }
+    
+    // Zwarte tablice bez luk po scalonych wpisach
+    int* targets = new int[kept[vertices]];
+    int* weights = new int[kept[vertices]];
+    parallelFor(row_tasks, num_threads, [&](int task, int) {
+        int first, last;
+        chunkRange(vertices, row_tasks, task, first, last);
+        for(int v = first; v < last; v++) {
+            int from = csr.offsets[v];
+            for(int i = kept[v]; i < kept[v + 1]; i++, from++) {
+                targets[i] = csr.targets[from];
+                weights[i] = csr.weights[from];
+            }
+        }
+    });
+    delete[] csr.offsets;
+    delete[] csr.targets;
+    delete[] csr.weights;
+    csr.offsets = kept;
+    csr.targets = targets;
+    csr.weights = weights;
+    return csr;
+}
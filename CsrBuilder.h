@@ -0,0 +1,33 @@
+#ifndef CSRBUILDER_H
+#define CSRBUILDER_H
+
+#include "Graph.h"
+
+// Opcje budowy CSR z tablicy krawedzi
+enum CsrBuildFlags {
+    CSR_SORT_ROWS = 1,        // sasiedzi w wierszu rosnaco wg numeru
+    CSR_REMOVE_DUPLICATES = 2 // powtorzone pary (u, v) scalane do najmniejszej wagi (wiersze sortowane)
+};
+
+// CSR: wiersz u to targets/weights[offsets[u] .. offsets[u + 1]); tablice zwalnia wywolujacy
+struct CsrArrays {
+    int* offsets;
+    int* targets;
+    int* weights;
+    int removed; // wpisy wierszy usuniete przez CSR_REMOVE_DUPLICATES
+};
+
+// Rownolegla budowa CSR z tablicy krawedzi:
+// 1. kazdy watek zlicza stopnie we wlasnym fragmencie krawedzi (osobne liczniki),
+// 2. sumy prefiksowe daja poczatki wierszy oraz miejsce kazdego watku w kazdym wierszu,
+// 3. rozproszenie bez synchronizacji - fragmenty wpisuja sie w kolejnosci krawedzi,
+//    wiec wynik jest taki sam jak przy dodawaniu krawedzi po kolei,
+// 4. opcjonalnie sortowanie wierszy i scalanie duplikatow (rownolegle po wierszach).
+// symmetric - krawedz trafia do wierszy obu koncow (graf nieskierowany).
+// num_threads < 1 - domyslna liczba watkow; male wejscia buduje jeden watek.
+CsrArrays buildCsrFromEdges(const Edge* edges, int edge_count, int vertices, bool symmetric, int flags, int num_threads);
+
+// Liczba watkow budowy dla edge_count krawedzi (num_threads < 1 - domyslna)
+int csrThreadCount(int edge_count, int num_threads);
+
+#endif
@@ -2,213 +2,617 @@
 #include <fstream>
 #include <string>
 #include <cstdlib>
-#include <ctime>
 #include <chrono>
 #include <iomanip>
 #include <climits>
+#include "Algorithms.h"
+#include "MinHeap.h"
+#include "DynamicSSSP.h"
+#include "Parallel.h"
 
-struct Edge {
-    int start, end, weight;
-    
-    Edge() : start(0), end(0), weight(0) {}
-    Edge(int s, int e, int w) : start(s), end(e), weight(w) {}
-};
-
-class Graph {
+// Hierarchia skrotow (Contraction Hierarchies) dla wielokrotnych zapytan punkt-punkt.
+// Wierzcholki sa kontraktowane w kolejnosci priorytetu (roznica krawedzi + liczba
+// usunietych sasiadow), a brakujace najkrotsze sciezki zastepowane skrotami.
+// Zapytanie to dwukierunkowy Dijkstra tylko "w gore" hierarchii.
+class ContractionHierarchy {
 private:
-    int vertices;
-    int edges_count;
-    int start_vertex;
-    int** adjacency_matrix;
-    Edge* edge_list;
-    int** adjacency_list;
-    int* list_sizes;
-    
-    void reallocateMemory(int new_vertices) {
-        if(adjacency_matrix) {
-            for(int i = 0; i < vertices; i++) {
-                delete[] adjacency_matrix[i];
-                delete[] adjacency_list[i];
-            }
-            delete[] adjacency_matrix;
-            delete[] adjacency_list;
-            delete[] list_sizes;
-            delete[] edge_list;
+    // Dynamiczna lista lukow uzywana w trakcie kontrakcji
+    struct ArcList {
+        int* target;
+        int* weight;
+        int size;
+        int capacity;
+        
+        ArcList() : target(nullptr), weight(nullptr), size(0), capacity(0) {}
+        
+        ~ArcList() {
+            delete[] target;
+            delete[] weight;
         }
         
-        vertices = new_vertices;
-        adjacency_matrix = new int*[vertices];
-        for(int i = 0; i < vertices; i++) {
-            adjacency_matrix[i] = new int[vertices];
-            for(int j = 0; j < vertices; j++) {
-                adjacency_matrix[i][j] = 0;
+        void append(int t, int w) {
+            if(size == capacity) {
+                int new_capacity = capacity > 0 ? capacity * 2 : 4;
+                int* new_target = new int[new_capacity];
+                int* new_weight = new int[new_capacity];
+                for(int i = 0; i < size; i++) {
+                    new_target[i] = target[i];
+                    new_weight[i] = weight[i];
+                }
+                delete[] target;
+                delete[] weight;
+                target = new_target;
+                weight = new_weight;
+                capacity = new_capacity;
             }
+            target[size] = t;
+            weight[size] = w;
+            size++;
         }
         
-        adjacency_list = new int*[vertices];
-        list_sizes = new int[vertices];
+        // Dodanie luku lub skrocenie juz istniejacego
+        void addOrDecrease(int t, int w) {
+            for(int i = 0; i < size; i++) {
+                if(target[i] == t) {
+                    if(w < weight[i]) weight[i] = w;
+                    return;
+                }
+            }
+            append(t, w);
+        }
+    };
+    
+    static const int WITNESS_SETTLE_LIMIT = 200; // limit zatwierdzen w wyszukiwaniu swiadka
+    
+    int vertices;
+    int shortcut_count;
+    int* rank;
+    
+    // Graf "w gore": luki u -> v z rank[v] > rank[u]
+    int* up_offsets;
+    int* up_targets;
+    int* up_weights;
+    // Graf "w dol" zapisany odwrotnie: dla v luki v <- u z rank[u] > rank[v]
+    int* down_offsets;
+    int* down_targets;
+    int* down_weights;
+    
+    // Bufory zapytan - alokowane raz, czyszczone przez liste odwiedzonych
+    int* dist_f;
+    int* dist_b;
+    int* touched;
+    int touched_count;
+    MinHeap* heap_f;
+    MinHeap* heap_b;
+    
+    // Struktury pomocnicze istniejace tylko podczas budowy
+    ArcList* out_arcs;
+    ArcList* in_arcs;
+    bool* contracted;
+    int* deleted_neighbors;
+    int* witness_dist;
+    int* witness_touched;
+    int witness_touched_count;
+    MinHeap* witness_heap;
+    
+    void allocateQueryBuffers() {
+        dist_f = new int[vertices];
+        dist_b = new int[vertices];
+        touched = new int[2 * vertices];
+        touched_count = 0;
         for(int i = 0; i < vertices; i++) {
-            adjacency_list[i] = new int[vertices * 2]; // [sasiad, waga, sasiad, waga, ...]
-            list_sizes[i] = 0;
+            dist_f[i] = INT_MAX;
+            dist_b[i] = INT_MAX;
         }
-        
-        edge_list = new Edge[vertices * vertices];
-        edges_count = 0;
+        heap_f = new MinHeap(vertices);
+        heap_b = new MinHeap(vertices);
     }
     
-public:
-    Graph(int v) : vertices(v), edges_count(0), start_vertex(0), adjacency_matrix(nullptr), 
-                   edge_list(nullptr), adjacency_list(nullptr), list_sizes(nullptr) {
-        reallocateMemory(v);
+    void freeAll() {
+        delete[] rank;
+        delete[] up_offsets;
+        delete[] up_targets;
+        delete[] up_weights;
+        delete[] down_offsets;
+        delete[] down_targets;
+        delete[] down_weights;
+        delete[] dist_f;
+        delete[] dist_b;
+        delete[] touched;
+        delete heap_f;
+        delete heap_b;
+        rank = up_offsets = up_targets = up_weights = nullptr;
+        down_offsets = down_targets = down_weights = nullptr;
+        dist_f = dist_b = touched = nullptr;
+        heap_f = heap_b = nullptr;
     }
     
-    ~Graph() {
-        if(adjacency_matrix) {
-            for(int i = 0; i < vertices; i++) {
-                delete[] adjacency_matrix[i];
-                delete[] adjacency_list[i];
+    // Ograniczony Dijkstra z source w grafie pozostalym po kontrakcji, z pominieciem skip
+    void witnessSearch(int source, int skip, int limit) {
+        witness_heap->clear();
+        witness_dist[source] = 0;
+        witness_touched[witness_touched_count++] = source;
+        witness_heap->insert(source, 0);
+        
+        int settled = 0;
+        while(!witness_heap->isEmpty() && settled < WITNESS_SETTLE_LIMIT) {
+            if(witness_heap->minKey() > limit) break;
+            int u = witness_heap->extractMin().vertex;
+            settled++;
+            
+            ArcList& arcs = out_arcs[u];
+            for(int i = 0; i < arcs.size; i++) {
+                int v = arcs.target[i];
+                if(v == skip || contracted[v]) continue;
+                int candidate = witness_dist[u] + arcs.weight[i];
+                if(candidate < witness_dist[v]) {
+                    if(witness_dist[v] == INT_MAX) {
+                        witness_touched[witness_touched_count++] = v;
+                        witness_heap->insert(v, candidate);
+                    } else if(witness_heap->isInHeap(v)) {
+                        witness_heap->decreaseKey(v, candidate);
+                    }
+                    witness_dist[v] = candidate;
+                }
             }
-            delete[] adjacency_matrix;
-            delete[] adjacency_list;
-            delete[] list_sizes;
-            delete[] edge_list;
         }
     }
     
-    void loadFromFile(const std::string& filename) {
-        std::ifstream file(filename);
-        if(!file.is_open()) {
-            std::cout << "Blad: Nie mozna otworzyc pliku " << filename << std::endl;
-            return;
+    void resetWitness() {
+        for(int i = 0; i < witness_touched_count; i++) {
+            witness_dist[witness_touched[i]] = INT_MAX;
+        }
+        witness_touched_count = 0;
+    }
+    
+    // Kontrakcja v (simulate == true: tylko policzenie potrzebnych skrotow)
+    int processNode(int v, bool simulate) {
+        int shortcuts = 0;
+        int max_out = 0;
+        for(int j = 0; j < out_arcs[v].size; j++) {
+            if(!contracted[out_arcs[v].target[j]] && out_arcs[v].weight[j] > max_out) {
+                max_out = out_arcs[v].weight[j];
+            }
         }
         
-        int file_edges, file_vertices;
-        file >> file_edges >> file_vertices >> start_vertex;
+        for(int i = 0; i < in_arcs[v].size; i++) {
+            int u = in_arcs[v].target[i];
+            if(u == v || contracted[u]) continue;
+            int weight_uv = in_arcs[v].weight[i];
+            
+            witnessSearch(u, v, weight_uv + max_out);
+            
+            for(int j = 0; j < out_arcs[v].size; j++) {
+                int x = out_arcs[v].target[j];
+                if(x == u || x == v || contracted[x]) continue;
+                int via = weight_uv + out_arcs[v].weight[j];
+                
+                // Brak swiadka krotszego lub rownego sciezce przez v - potrzebny skrot
+                if(witness_dist[x] > via) {
+                    shortcuts++;
+                    if(!simulate) {
+                        out_arcs[u].addOrDecrease(x, via);
+                        in_arcs[x].addOrDecrease(u, via);
+                    }
+                }
+            }
+            resetWitness();
+        }
         
-        reallocateMemory(file_vertices);
+        return shortcuts;
+    }
+    
+    int computePriority(int v) {
+        int removed = 0;
+        for(int i = 0; i < in_arcs[v].size; i++) {
+            if(!contracted[in_arcs[v].target[i]]) removed++;
+        }
+        for(int i = 0; i < out_arcs[v].size; i++) {
+            if(!contracted[out_arcs[v].target[i]]) removed++;
+        }
+        return processNode(v, true) - removed + deleted_neighbors[v];
+    }
+    
+    // Spakowanie lukow (oryginalnych i skrotow) do CSR w gore i w dol
+    void buildSearchGraphs() {
+        up_offsets = new int[vertices + 1];
+        down_offsets = new int[vertices + 1];
+        for(int v = 0; v <= vertices; v++) {
+            up_offsets[v] = 0;
+            down_offsets[v] = 0;
+        }
         
-        for(int i = 0; i < file_edges; i++) {
-            int start, end, weight;
-            file >> start >> end >> weight;
-            addEdge(start, end, weight);
-            edge_list[i] = Edge(start, end, weight);
+        for(int u = 0; u < vertices; u++) {
+            for(int i = 0; i < out_arcs[u].size; i++) {
+                int v = out_arcs[u].target[i];
+                if(rank[v] > rank[u]) up_offsets[u + 1]++;
+                else if(rank[v] < rank[u]) down_offsets[v + 1]++;
+            }
+        }
+        for(int v = 0; v < vertices; v++) {
+            up_offsets[v + 1] += up_offsets[v];
+            down_offsets[v + 1] += down_offsets[v];
         }
-        edges_count = file_edges;
         
-        file.close();
+        up_targets = new int[up_offsets[vertices]];
+        up_weights = new int[up_offsets[vertices]];
+        down_targets = new int[down_offsets[vertices]];
+        down_weights = new int[down_offsets[vertices]];
         
-        std::cout << "Graf wczytany z pliku (wierzcholek startowy: " << start_vertex << "). Reprezentacje:" << std::endl;
-        displayMatrix();
-        displayList();
+        int* up_fill = new int[vertices];
+        int* down_fill = new int[vertices];
+        for(int v = 0; v < vertices; v++) {
+            up_fill[v] = up_offsets[v];
+            down_fill[v] = down_offsets[v];
+        }
+        for(int u = 0; u < vertices; u++) {
+            for(int i = 0; i < out_arcs[u].size; i++) {
+                int v = out_arcs[u].target[i];
+                if(rank[v] > rank[u]) {
+                    up_targets[up_fill[u]] = v;
+                    up_weights[up_fill[u]++] = out_arcs[u].weight[i];
+                } else if(rank[v] < rank[u]) {
+                    down_targets[down_fill[v]] = u;
+                    down_weights[down_fill[v]++] = out_arcs[u].weight[i];
+                }
+            }
+        }
+        delete[] up_fill;
+        delete[] down_fill;
+    }
+    
+public:
+    ContractionHierarchy() : vertices(0), shortcut_count(0), rank(nullptr),
+                             up_offsets(nullptr), up_targets(nullptr), up_weights(nullptr),
+                             down_offsets(nullptr), down_targets(nullptr), down_weights(nullptr),
+                             dist_f(nullptr), dist_b(nullptr), touched(nullptr), touched_count(0),
+                             heap_f(nullptr), heap_b(nullptr) {}
+    
+    ~ContractionHierarchy() {
+        freeAll();
     }
     
-    void generateRandom(int v, int density) {
-        reallocateMemory(v);
-        start_vertex = 0; // Domyslny wierzcholek startowy
+    int getVertices() { return vertices; }
+    int getShortcutCount() { return shortcut_count; }
+    
+    // Budowa hierarchii z grafu w postaci CSR
+    void build(int n, const int* offsets, const int* targets, const int* weights) {
+        freeAll();
+        vertices = n;
+        shortcut_count = 0;
+        if(n <= 0) return;
         
-        // Generowanie cyklu dla spojnosci (graf skierowany)
-        for(int i = 0; i < vertices; i++) {
-            int next = (i + 1) % vertices;
-            int weight = rand() % 100 + 1;
-            addEdge(i, next, weight);
-            edge_list[edges_count++] = Edge(i, next, weight);
+        out_arcs = new ArcList[n];
+        in_arcs = new ArcList[n];
+        contracted = new bool[n];
+        deleted_neighbors = new int[n];
+        witness_dist = new int[n];
+        witness_touched = new int[n];
+        witness_touched_count = 0;
+        witness_heap = new MinHeap(n);
+        rank = new int[n];
+        
+        // Luki wejsciowe bez petli wlasnych; krawedzie rownolegle scalane (minimalna waga)
+        int* position = new int[n];
+        for(int v = 0; v < n; v++) position[v] = -1;
+        for(int u = 0; u < n; u++) {
+            for(int e = offsets[u]; e < offsets[u + 1]; e++) {
+                int v = targets[e];
+                if(v == u) continue;
+                if(position[v] >= 0) {
+                    if(weights[e] < out_arcs[u].weight[position[v]]) out_arcs[u].weight[position[v]] = weights[e];
+                } else {
+                    position[v] = out_arcs[u].size;
+                    out_arcs[u].append(v, weights[e]);
+                }
+            }
+            for(int i = 0; i < out_arcs[u].size; i++) {
+                position[out_arcs[u].target[i]] = -1;
+                in_arcs[out_arcs[u].target[i]].append(u, out_arcs[u].weight[i]);
+            }
         }
+        delete[] position;
         
-        int max_edges = vertices * (vertices - 1); // Graf skierowany
-        int target_edges = (max_edges * density) / 100;
+        for(int v = 0; v < n; v++) {
+            contracted[v] = false;
+            deleted_neighbors[v] = 0;
+            witness_dist[v] = INT_MAX;
+            rank[v] = -1;
+        }
+        
+        // Kolejnosc wierzcholkow: kopiec priorytetow z leniwa aktualizacja
+        MinHeap order(n);
+        for(int v = 0; v < n; v++) {
+            order.insert(v, computePriority(v));
+        }
         
-        while(edges_count < target_edges) {
-            int start = rand() % vertices;
-            int end = rand() % vertices;
+        int next_rank = 0;
+        while(!order.isEmpty()) {
+            int v = order.extractMin().vertex;
+            int priority = computePriority(v);
+            if(!order.isEmpty() && priority > order.minKey()) {
+                order.insert(v, priority);
+                continue;
+            }
+            
+            shortcut_count += processNode(v, false);
+            contracted[v] = true;
+            rank[v] = next_rank++;
             
-            if(start != end && adjacency_matrix[start][end] == 0) {
-                int weight = rand() % 100 + 1;
-                addEdge(start, end, weight);
-                edge_list[edges_count++] = Edge(start, end, weight);
+            for(int i = 0; i < in_arcs[v].size; i++) {
+                if(!contracted[in_arcs[v].target[i]]) deleted_neighbors[in_arcs[v].target[i]]++;
+            }
+            for(int i = 0; i < out_arcs[v].size; i++) {
+                if(!contracted[out_arcs[v].target[i]]) deleted_neighbors[out_arcs[v].target[i]]++;
             }
         }
         
-        std::cout << "Graf wygenerowany losowo (" << vertices << " wierzcholkow, " 
-                  << density << "% gestosci, " << edges_count << " krawedzi, start: " << start_vertex << ")" << std::endl;
-        displayMatrix();
-        displayList();
+        buildSearchGraphs();
+        
+        delete[] out_arcs;
+        delete[] in_arcs;
+        delete[] contracted;
+        delete[] deleted_neighbors;
+        delete[] witness_dist;
+        delete[] witness_touched;
+        delete witness_heap;
+        
+        allocateQueryBuffers();
     }
     
-    void generateRandomForTesting(int v, int density) {
-        reallocateMemory(v);
-        start_vertex = 0;
-        
-        // Generowanie cyklu dla spojnosci
-        for(int i = 0; i < vertices; i++) {
-            int next = (i + 1) % vertices;
-            int weight = rand() % 100 + 1;
-            addEdge(i, next, weight);
-            edge_list[edges_count++] = Edge(i, next, weight);
+    // Zapytanie punkt-punkt: dwukierunkowe przeszukiwanie w gore hierarchii.
+    // Kazda strona konczy, gdy minimum jej kopca nie moze poprawic najlepszego wyniku.
+    int query(int source, int target, int& settled_count) {
+        for(int i = 0; i < touched_count; i++) {
+            dist_f[touched[i]] = INT_MAX;
+            dist_b[touched[i]] = INT_MAX;
         }
+        touched_count = 0;
+        heap_f->clear();
+        heap_b->clear();
+        
+        dist_f[source] = 0;
+        dist_b[target] = 0;
+        touched[touched_count++] = source;
+        touched[touched_count++] = target;
+        heap_f->insert(source, 0);
+        heap_b->insert(target, 0);
         
-        int max_edges = vertices * (vertices - 1);
-        int target_edges = (max_edges * density) / 100;
+        long long best = LLONG_MAX;
+        settled_count = 0;
         
-        while(edges_count < target_edges) {
-            int start = rand() % vertices;
-            int end = rand() % vertices;
+        while(true) {
+            bool forward_active = !heap_f->isEmpty() && heap_f->minKey() < best;
+            bool backward_active = !heap_b->isEmpty() && heap_b->minKey() < best;
+            if(!forward_active && !backward_active) break;
+            
+            bool forward = forward_active && (!backward_active || heap_f->minKey() <= heap_b->minKey());
+            MinHeap* heap = forward ? heap_f : heap_b;
+            int* dist = forward ? dist_f : dist_b;
+            int* other_dist = forward ? dist_b : dist_f;
+            int* offsets = forward ? up_offsets : down_offsets;
+            int* targets = forward ? up_targets : down_targets;
+            int* weights = forward ? up_weights : down_weights;
+            
+            int u = heap->extractMin().vertex;
+            settled_count++;
+            
+            if(other_dist[u] != INT_MAX && (long long)dist[u] + other_dist[u] < best) {
+                best = (long long)dist[u] + other_dist[u];
+            }
             
-            if(start != end && adjacency_matrix[start][end] == 0) {
-                int weight = rand() % 100 + 1;
-                addEdge(start, end, weight);
-                edge_list[edges_count++] = Edge(start, end, weight);
+            for(int e = offsets[u]; e < offsets[u + 1]; e++) {
+                int v = targets[e];
+                int candidate = dist[u] + weights[e];
+                if(candidate < dist[v]) {
+                    if(dist_f[v] == INT_MAX && dist_b[v] == INT_MAX) {
+                        touched[touched_count++] = v;
+                    }
+                    if(heap->isInHeap(v)) {
+                        heap->decreaseKey(v, candidate);
+                    } else {
+                        heap->insert(v, candidate);
+                    }
+                    dist[v] = candidate;
+                }
             }
         }
+        
+        return best == LLONG_MAX ? INT_MAX : (int)best;
     }
     
-    void addEdge(int start, int end, int weight) {
-        // Graf skierowany - tylko jedna krawedz
-        adjacency_matrix[start][end] = weight;
+    // Format pliku: "CH01", int32 V, int32 liczba skrotow, int32 rozmiary grafu w gore i w dol,
+    // nastepnie rank[V], up_offsets[V+1], up_targets, up_weights, down_offsets[V+1], down_targets, down_weights
+    bool save(const std::string& filename) {
+        std::ofstream file(filename, std::ios::binary);
+        if(!file.is_open()) {
+            std::cout << "Blad: Nie mozna utworzyc pliku " << filename << std::endl;
+            return false;
+        }
         
-        // Lista sasiedztwa: [sasiad, waga, sasiad, waga, ...]
-        adjacency_list[start][list_sizes[start] * 2] = end;
-        adjacency_list[start][list_sizes[start] * 2 + 1] = weight;
-        list_sizes[start]++;
+        int up_count = up_offsets[vertices];
+        int down_count = down_offsets[vertices];
+        file.write("CH01", 4);
+        file.write(reinterpret_cast<const char*>(&vertices), sizeof(int));
+        file.write(reinterpret_cast<const char*>(&shortcut_count), sizeof(int));
+        file.write(reinterpret_cast<const char*>(&up_count), sizeof(int));
+        file.write(reinterpret_cast<const char*>(&down_count), sizeof(int));
+        file.write(reinterpret_cast<const char*>(rank), vertices * sizeof(int));
+        file.write(reinterpret_cast<const char*>(up_offsets), (vertices + 1) * sizeof(int));
+        file.write(reinterpret_cast<const char*>(up_targets), up_count * sizeof(int));
+        file.write(reinterpret_cast<const char*>(up_weights), up_count * sizeof(int));
+        file.write(reinterpret_cast<const char*>(down_offsets), (vertices + 1) * sizeof(int));
+        file.write(reinterpret_cast<const char*>(down_targets), down_count * sizeof(int));
+        file.write(reinterpret_cast<const char*>(down_weights), down_count * sizeof(int));
+        file.close();
+        return true;
     }
     
-    void displayMatrix() {
-        if(vertices > 20) {
-            std::cout << "\nGraf zbyt duzy do wyswietlenia macierzy (>20 wierzcholkow)" << std::endl;
-            return;
+    bool load(const std::string& filename) {
+        std::ifstream file(filename, std::ios::binary);
+        if(!file.is_open()) {
+            std::cout << "Blad: Nie mozna otworzyc pliku " << filename << std::endl;
+            return false;
         }
         
-        std::cout << "\nReprezentacja macierzowa (graf skierowany):" << std::endl;
-        std::cout << "   ";
-        for(int i = 0; i < vertices; i++) {
-            std::cout << i << "  ";
+        char magic[4];
+        int n, shortcuts, up_count, down_count;
+        file.read(magic, 4);
+        file.read(reinterpret_cast<char*>(&n), sizeof(int));
+        file.read(reinterpret_cast<char*>(&shortcuts), sizeof(int));
+        file.read(reinterpret_cast<char*>(&up_count), sizeof(int));
+        file.read(reinterpret_cast<char*>(&down_count), sizeof(int));
+        if(!file || magic[0] != 'C' || magic[1] != 'H' || magic[2] != '0' || magic[3] != '1' ||
+           n <= 0 || shortcuts < 0 || up_count < 0 || down_count < 0) {
+            std::cout << "Blad: Nieprawidlowy plik hierarchii " << filename << std::endl;
+            return false;
         }
-        std::cout << std::endl;
         
-        for(int i = 0; i < vertices; i++) {
-            std::cout << i << ": ";
-            for(int j = 0; j < vertices; j++) {
-                std::cout << adjacency_matrix[i][j] << "  ";
-            }
-            std::cout << std::endl;
+        // Rozmiar pliku zgodny z licznikami z naglowka - przed przydzieleniem tablic
+        std::streampos body_start = file.tellg();
+        file.seekg(0, std::ios::end);
+        long long body_size = (long long)(file.tellg() - body_start);
+        file.seekg(body_start);
+        long long expected = ((long long)n + 2LL * (n + 1) + 2LL * up_count + 2LL * down_count) * (long long)sizeof(int);
+        if(body_size != expected) {
+            std::cout << "Blad: Plik hierarchii " << filename << " jest niekompletny lub ma nadmiarowe dane" << std::endl;
+            return false;
+        }
+        
+        freeAll();
+        vertices = n;
+        shortcut_count = shortcuts;
+        rank = new int[n];
+        up_offsets = new int[n + 1];
+        up_targets = new int[up_count];
+        up_weights = new int[up_count];
+        down_offsets = new int[n + 1];
+        down_targets = new int[down_count];
+        down_weights = new int[down_count];
+        
+        file.read(reinterpret_cast<char*>(rank), n * sizeof(int));
+        file.read(reinterpret_cast<char*>(up_offsets), (n + 1) * sizeof(int));
+        file.read(reinterpret_cast<char*>(up_targets), up_count * sizeof(int));
+        file.read(reinterpret_cast<char*>(up_weights), up_count * sizeof(int));
+        file.read(reinterpret_cast<char*>(down_offsets), (n + 1) * sizeof(int));
+        file.read(reinterpret_cast<char*>(down_targets), down_count * sizeof(int));
+        file.read(reinterpret_cast<char*>(down_weights), down_count * sizeof(int));
+        
+        if(!file) {
+            std::cout << "Blad: Plik hierarchii " << filename << " jest niekompletny" << std::endl;
+            freeAll();
+            vertices = 0;
+            return false;
+        }
+        if(!validRanks() || !validArcs(up_offsets, up_targets, up_weights, up_count) ||
+           !validArcs(down_offsets, down_targets, down_weights, down_count)) {
+            std::cout << "Blad: Plik hierarchii " << filename << " zawiera niespojne dane" << std::endl;
+            freeAll();
+            vertices = 0;
+            return false;
         }
+        
+        allocateQueryBuffers();
+        return true;
     }
     
-    void displayList() {
-        if(vertices > 20) {
-            std::cout << "\nGraf zbyt duzy do wyswietlenia listy (>20 wierzcholkow)" << std::endl;
-            return;
+    // Niezmienniki wczytanej hierarchii, na ktorych polega query: rank jest permutacja,
+    // przesuniecia rosna od 0 do liczby lukow, cele leza w [0, V) i maja wyzszy rank
+    // (w obu grafach), a wagi sa nieujemne
+    bool validRanks() const {
+        bool* seen = new bool[vertices];
+        for(int i = 0; i < vertices; i++) seen[i] = false;
+        bool valid = true;
+        for(int i = 0; i < vertices && valid; i++) {
+            if(rank[i] < 0 || rank[i] >= vertices || seen[rank[i]]) valid = false;
+            else seen[rank[i]] = true;
         }
-        
-        std::cout << "\nReprezentacja listowa (graf skierowany):" << std::endl;
-        for(int i = 0; i < vertices; i++) {
-            std::cout << i << ": ";
-            for(int j = 0; j < list_sizes[i]; j++) {
-                int neighbor = adjacency_list[i][j * 2];
-                int weight = adjacency_list[i][j * 2 + 1];
-                std::cout << "(" << neighbor << "," << weight << ") ";
+        delete[] seen;
+        return valid;
+    }
+    
+    bool validArcs(const int* offsets, const int* targets, const int* weights, int count) const {
+        if(offsets[0] != 0 || offsets[vertices] != count) return false;
+        for(int u = 0; u < vertices; u++) {
+            if(offsets[u] > offsets[u + 1]) return false;
+        }
+        for(int u = 0; u < vertices; u++) {
+            for(int e = offsets[u]; e < offsets[u + 1]; e++) {
+                int v = targets[e];
+                if(v < 0 || v >= vertices || rank[v] <= rank[u] || weights[e] < 0) return false;
             }
-            std::cout << std::endl;
         }
+        return true;
+    }
+};
+
+// Hierarchia zbudowana dla konkretnego grafu - uniewazniana, gdy graf zmieni wersje
+static ContractionHierarchy* hierarchy = nullptr;
+static const Graph* hierarchy_graph = nullptr;
+static int hierarchy_version = 0;
+
+// Sprawdzane tylko w opcjach korzystajacych z hierarchii (menu), nie w silnikach
+// uruchamianych rownolegle przez testy wydajnosci
+static void dropStaleHierarchy(const Graph& graph) {
+    if(hierarchy && (hierarchy_graph != &graph || hierarchy_version != graph.getVersion())) {
+        delete hierarchy;
+        hierarchy = nullptr;
+    }
+}
+
+static void rememberHierarchy(ContractionHierarchy* built, const Graph& graph) {
+    if(built != hierarchy) delete hierarchy;
+    hierarchy = built;
+    hierarchy_graph = &graph;
+    hierarchy_version = graph.getVersion();
+}
+
+// Silnik Dijkstry na wspolnym grafie: wskazniki do reprezentacji pobierane z grafu
+// przy tworzeniu i po kazdej zmianie grafu wykonanej przez silnik (sync()).
+class DijkstraSolver {
+private:
+    Graph& graph;
+    int vertices;
+    int start_vertex;
+    int** adjacency_list;
+    int* list_sizes;
+    const int* original_id;
+    const int* current_id;
+    const int* csr_offsets;
+    const int* csr_targets;
+    const int* csr_weights;
+    const int* rcsr_offsets;
+    const int* rcsr_targets;
+    const int* rcsr_weights;
+    
+    void sync() {
+        vertices = graph.getVertices();
+        start_vertex = graph.getStartVertex();
+        adjacency_list = graph.getList();
+        list_sizes = graph.getListSizes();
+        original_id = graph.getOriginalId();
+        current_id = graph.getCurrentId();
+        csr_offsets = graph.getCsrOffsets();
+        csr_targets = graph.getCsrTargets();
+        csr_weights = graph.getCsrWeights();
+        rcsr_offsets = graph.getReverseCsrOffsets();
+        rcsr_targets = graph.getReverseCsrTargets();
+        rcsr_weights = graph.getReverseCsrWeights();
+    }
+    
+    void buildCSR() {
+        graph.buildCSR();
+        sync();
+    }
+    
+    void buildReverseCSR() {
+        graph.buildReverseCSR();
+        sync();
+    }
+    
+public:
+    DijkstraSolver(Graph& g) : graph(g) {
+        sync();
     }
     
     int minDistance(int dist[], bool sptSet[]) {
@@ -224,25 +628,32 @@ public:
         return min_index;
     }
     
-    void printPath(int parent[], int vertex, int* path, int& path_length) {
-        if(parent[vertex] == -1) {
-            path[path_length++] = vertex;
-            return;
+    
+    // Relaksacja sasiadow u z wiersza zwartej macierzy wag typu W; sasiedzi wg mapy bitowej,
+    // wiec puste slowa (64 pary) sa pomijane bez czytania wag
+    template<typename W>
+    void relaxMatrixRow(const W* adjacency_matrix, const AdjacencyBitmap& bits, int u, int* dist, int* parent,
+                        const bool* sptSet) {
+        if(dist[u] == INT_MAX) return;
+        const W* row = adjacency_matrix + (size_t)u * vertices;
+        const uint64_t* row_bits = bits.row(u);
+        for(int word = 0; word < bits.rowWords(); word++) {
+            for(uint64_t mask = row_bits[word]; mask; mask &= mask - 1) {
+                int v = word * 64 + lowestBit(mask);
+                int weight = row[v];
+                if(!sptSet[v] && dist[u] + weight < dist[v]) {
+                    dist[v] = dist[u] + weight;
+                    parent[v] = u;
+                }
+            }
         }
-        
-        printPath(parent, parent[vertex], path, path_length);
-        path[path_length++] = vertex;
     }
     
-    void dijkstraMatrix() {
-        std::cout << "\nAlgorytm Dijkstry - reprezentacja macierzowa:" << std::endl;
-        std::cout << "Wierzcholek startowy: " << start_vertex << std::endl;
-        
-        auto start_time = std::chrono::high_resolution_clock::now();
-        
-        int* dist = new int[vertices];
+    // Dijkstra z wyszukiwaniem liniowym minimum: sasiedzi ze zwartej macierzy lub z listy.
+    // Odleglosci int we wszystkich wariantach - grafy, w ktorych moglyby sie przepelnic
+    // (Graph::distancesFitInt), odrzuca acceptsGraph przed uruchomieniem.
+    void dijkstraArray(int representation, int* dist, int* parent) {
         bool* sptSet = new bool[vertices];
-        int* parent = new int[vertices];
         
         for(int i = 0; i < vertices; i++) {
             dist[i] = INT_MAX;
@@ -256,334 +667,766 @@ public:
             int u = minDistance(dist, sptSet);
             sptSet[u] = true;
             
-            for(int v = 0; v < vertices; v++) {
-                if(!sptSet[v] && adjacency_matrix[u][v] && 
-                   dist[u] != INT_MAX && dist[u] + adjacency_matrix[u][v] < dist[v]) {
-                    dist[v] = dist[u] + adjacency_matrix[u][v];
-                    parent[v] = u;
+            if(representation == REP_MATRIX) {
+                const AdjacencyBitmap& bits = graph.getAdjacencyBitmap();
+                switch(graph.getWeightWidth()) {
+                    case WEIGHT_INT8: relaxMatrixRow(graph.getNarrowMatrix<int8_t>(), bits, u, dist, parent, sptSet); break;
+                    case WEIGHT_INT16: relaxMatrixRow(graph.getNarrowMatrix<int16_t>(), bits, u, dist, parent, sptSet); break;
+                    default: relaxMatrixRow(graph.getNarrowMatrix<int32_t>(), bits, u, dist, parent, sptSet); break;
                 }
-            }
-        }
-        
-        auto end_time = std::chrono::high_resolution_clock::now();
-        auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(end_time - start_time);
-        double seconds = duration.count() / 1000000000.0;
-        
-        std::cout << "Najkrotsze sciezki od wierzcholka " << start_vertex << ":" << std::endl;
-        for(int i = 0; i < vertices; i++) {
-            if(i != start_vertex) {
-                std::cout << "Do wierzcholka " << i << ": ";
-                if(dist[i] == INT_MAX) {
-                    std::cout << "NIEOSIAGALNY" << std::endl;
-                } else {
-                    std::cout << "koszt = " << dist[i] << ", sciezka: ";
-                    int* path = new int[vertices];
-                    int path_length = 0;
-                    printPath(parent, i, path, path_length);
+            } else {
+                for(int i = 0; i < list_sizes[u]; i++) {
+                    int v = adjacency_list[u][i * 2];
+                    int weight = adjacency_list[u][i * 2 + 1];
                     
-                    for(int j = 0; j < path_length; j++) {
-                        std::cout << path[j];
-                        if(j < path_length - 1) std::cout << " -> ";
+                    if(!sptSet[v] && dist[u] != INT_MAX && dist[u] + weight < dist[v]) {
+                        dist[v] = dist[u] + weight;
+                        parent[v] = u;
                     }
-                    std::cout << std::endl;
-                    delete[] path;
                 }
             }
         }
         
-        std::cout << "Czas wykonania (reprezentacja macierzowa): " << std::fixed << std::setprecision(6) << seconds << " sekund" << std::endl;
-        
-        delete[] dist;
         delete[] sptSet;
-        delete[] parent;
     }
     
-    void dijkstraList() {
-        std::cout << "\nAlgorytm Dijkstry - reprezentacja listowa:" << std::endl;
-        std::cout << "Wierzcholek startowy: " << start_vertex << std::endl;
-        
+    double timedDijkstra(int representation, int* dist, int* parent) {
+        // Zwarta macierz jest reprezentacja grafu - budowana poza pomiarem, jak macierz int
+        if(representation == REP_MATRIX) graph.buildNarrowMatrix();
         auto start_time = std::chrono::high_resolution_clock::now();
-        
-        int* dist = new int[vertices];
-        bool* sptSet = new bool[vertices];
-        int* parent = new int[vertices];
-        
+        dijkstraArray(representation, dist, parent);
+        auto end_time = std::chrono::high_resolution_clock::now();
+        auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(end_time - start_time);
+        return duration.count() / 1000000000.0;
+    }
+    
+    // Dijkstra z kopcem ze startu grafu; bufory robocze przydzielane w mierzonym czasie,
+    // jak tablica odwiedzonych w dijkstraArray
+    double timedDijkstraHeap(int* dist, int* parent) {
+        auto start_time = std::chrono::high_resolution_clock::now();
+        bool* settled = new bool[vertices];
+        MinHeap heap(vertices);
+        dijkstraHeap(start_vertex, dist, parent, settled, heap);
+        delete[] settled;
+        auto end_time = std::chrono::high_resolution_clock::now();
+        auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(end_time - start_time);
+        return duration.count() / 1000000000.0;
+    }
+    
+    // Dijkstra z kopcem na liscie sasiedztwa - wersja dla zapytan wsadowych.
+    // Korzysta wylacznie z buforow przekazanych przez wywolujacego, wiec wiele
+    // watkow moze jednoczesnie pytac ten sam graf (tylko odczyt).
+    void dijkstraHeap(int source, int* dist, int* parent, bool* settled, MinHeap& heap) {
         for(int i = 0; i < vertices; i++) {
             dist[i] = INT_MAX;
-            sptSet[i] = false;
             parent[i] = -1;
+            settled[i] = false;
         }
+        heap.clear();
         
-        dist[start_vertex] = 0;
+        dist[source] = 0;
+        heap.insert(source, 0);
         
-        for(int count = 0; count < vertices - 1; count++) {
-            int u = minDistance(dist, sptSet);
-            sptSet[u] = true;
+        while(!heap.isEmpty()) {
+            int u = heap.extractMin().vertex;
+            settled[u] = true;
             
             for(int i = 0; i < list_sizes[u]; i++) {
                 int v = adjacency_list[u][i * 2];
                 int weight = adjacency_list[u][i * 2 + 1];
                 
-                if(!sptSet[v] && dist[u] != INT_MAX && dist[u] + weight < dist[v]) {
+                if(!settled[v] && dist[u] + weight < dist[v]) {
                     dist[v] = dist[u] + weight;
                     parent[v] = u;
+                    
+                    if(heap.isInHeap(v)) {
+                        heap.decreaseKey(v, dist[v]);
+                    } else {
+                        heap.insert(v, dist[v]);
+                    }
+                }
+            }
+        }
+    }
+    
+    // Zapytania wsadowe: najkrotsze sciezki z wielu zrodel liczone rownolegle.
+    // targets == nullptr -> pelne tablice dist/parent dla kazdego zrodla,
+    // w przeciwnym razie tylko odleglosci do podanych celow (bez tablicy parent).
+    BatchResult* batchDijkstra(const int* sources, int num_sources, const int* targets, int num_targets, int num_threads) {
+        bool full = (targets == nullptr);
+        BatchResult* result = new BatchResult(num_sources, full ? vertices : num_targets, full);
+        
+        if(num_threads < 1) num_threads = defaultThreadCount();
+        if(num_threads > num_sources) num_threads = num_sources > 0 ? num_sources : 1;
+        
+        // Bufory robocze kazdego watku - alokowane raz na cala paczke zapytan
+        int** scratch_dist = new int*[num_threads];
+        int** scratch_parent = new int*[num_threads];
+        bool** scratch_settled = new bool*[num_threads];
+        MinHeap** heaps = new MinHeap*[num_threads];
+        for(int t = 0; t < num_threads; t++) {
+            scratch_dist[t] = full ? nullptr : new int[vertices];
+            scratch_parent[t] = full ? nullptr : new int[vertices];
+            scratch_settled[t] = new bool[vertices];
+            heaps[t] = new MinHeap(vertices);
+        }
+        
+        parallelFor(num_sources, num_threads, [&](int query, int t) {
+            if(full) {
+                // W trybie pelnym wynik trafia bezposrednio do wiersza zapytania
+                int* dist = result->dist + (long long)query * vertices;
+                int* parent = result->parent + (long long)query * vertices;
+                dijkstraHeap(sources[query], dist, parent, scratch_settled[t], *heaps[t]);
+            } else {
+                dijkstraHeap(sources[query], scratch_dist[t], scratch_parent[t], scratch_settled[t], *heaps[t]);
+                int* row = result->dist + (long long)query * num_targets;
+                for(int i = 0; i < num_targets; i++) {
+                    row[i] = scratch_dist[t][targets[i]];
                 }
             }
+        });
+        
+        for(int t = 0; t < num_threads; t++) {
+            delete[] scratch_dist[t];
+            delete[] scratch_parent[t];
+            delete[] scratch_settled[t];
+            delete heaps[t];
         }
+        delete[] scratch_dist;
+        delete[] scratch_parent;
+        delete[] scratch_settled;
+        delete[] heaps;
+        
+        return result;
+    }
+    
+    void batchQueries() {
+        std::cout << "\nZapytania wsadowe (wiele zrodel, Dijkstra z kopcem):" << std::endl;
         
+        int num_sources, num_targets, num_threads;
+        std::cout << "Podaj liczbe zapytan/zrodel (0 = wszystkie wierzcholki): ";
+        std::cin >> num_sources;
+        std::cout << "Podaj liczbe celow (0 = pelne tablice dist/parent): ";
+        std::cin >> num_targets;
+        std::cout << "Podaj liczbe watkow (0 = automatycznie): ";
+        std::cin >> num_threads;
+        
+        if(num_sources <= 0) num_sources = vertices;
+        if(num_targets < 0) num_targets = 0;
+        if(num_threads <= 0) num_threads = defaultThreadCount();
+        
+        int* sources = new int[num_sources];
+        for(int i = 0; i < num_sources; i++) {
+            sources[i] = (num_sources == vertices) ? i : rand() % vertices;
+        }
+        
+        int* targets = nullptr;
+        if(num_targets > 0) {
+            targets = new int[num_targets];
+            for(int i = 0; i < num_targets; i++) {
+                targets[i] = rand() % vertices;
+            }
+        }
+        
+        auto start_time = std::chrono::high_resolution_clock::now();
+        BatchResult* result = batchDijkstra(sources, num_sources, targets, num_targets, num_threads);
         auto end_time = std::chrono::high_resolution_clock::now();
         auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(end_time - start_time);
         double seconds = duration.count() / 1000000000.0;
         
-        std::cout << "Najkrotsze sciezki od wierzcholka " << start_vertex << ":" << std::endl;
-        for(int i = 0; i < vertices; i++) {
-            if(i != start_vertex) {
-                std::cout << "Do wierzcholka " << i << ": ";
-                if(dist[i] == INT_MAX) {
-                    std::cout << "NIEOSIAGALNY" << std::endl;
-                } else {
-                    std::cout << "koszt = " << dist[i] << ", sciezka: ";
-                    int* path = new int[vertices];
-                    int path_length = 0;
-                    printPath(parent, i, path, path_length);
-                    
-                    for(int j = 0; j < path_length; j++) {
-                        std::cout << path[j];
-                        if(j < path_length - 1) std::cout << " -> ";
-                    }
-                    std::cout << std::endl;
-                    delete[] path;
+        if(vertices <= 20) {
+            for(int q = 0; q < num_sources; q++) {
+                std::cout << "Zrodlo " << original_id[sources[q]] << ": ";
+                for(int i = 0; i < result->row_length; i++) {
+                    int d = result->dist[(size_t)q * result->row_length + i];
+                    int target = targets ? targets[i] : i;
+                    std::cout << original_id[target] << "=";
+                    if(d == INT_MAX) std::cout << "INF ";
+                    else std::cout << d << " ";
                 }
+                std::cout << std::endl;
             }
         }
         
-        std::cout << "Czas wykonania (reprezentacja listowa): " << std::fixed << std::setprecision(6) << seconds << " sekund" << std::endl;
+        std::cout << "Zapytan: " << num_sources << ", watkow: " << num_threads << std::endl;
+        std::cout << "Czas wykonania: " << std::fixed << std::setprecision(6) << seconds << " sekund" << std::endl;
+        if(seconds > 0) {
+            std::cout << "Przepustowosc: " << std::fixed << std::setprecision(1) << num_sources / seconds << " zapytan/s" << std::endl;
+        }
         
-        delete[] dist;
-        delete[] sptSet;
-        delete[] parent;
+        delete result;
+        delete[] sources;
+        delete[] targets;
     }
     
-    double executeDijkstraMatrix() {
-        auto start_time = std::chrono::high_resolution_clock::now();
+    // Dijkstra punkt-punkt: konczy prace w momencie zatwierdzenia wierzcholka docelowego.
+    // target == -1 oznacza pelny przebieg (zatwierdzenie wszystkich osiagalnych wierzcholkow).
+    // Zwraca odleglosc (INT_MAX gdy cel nieosiagalny), settled_count - liczba zatwierdzonych wierzcholkow.
+    int dijkstraPointToPoint(int source, int target, int* parent, int& settled_count) {
+        buildCSR();
         
         int* dist = new int[vertices];
-        bool* sptSet = new bool[vertices];
-        int* parent = new int[vertices];
+        bool* settled = new bool[vertices];
+        MinHeap heap(vertices);
         
         for(int i = 0; i < vertices; i++) {
             dist[i] = INT_MAX;
-            sptSet[i] = false;
+            settled[i] = false;
             parent[i] = -1;
         }
         
-        dist[start_vertex] = 0;
+        dist[source] = 0;
+        heap.insert(source, 0);
+        settled_count = 0;
         
-        for(int count = 0; count < vertices - 1; count++) {
-            int u = minDistance(dist, sptSet);
-            sptSet[u] = true;
+        while(!heap.isEmpty()) {
+            int u = heap.extractMin().vertex;
+            settled[u] = true;
+            settled_count++;
             
-            for(int v = 0; v < vertices; v++) {
-                if(!sptSet[v] && adjacency_matrix[u][v] && 
-                   dist[u] != INT_MAX && dist[u] + adjacency_matrix[u][v] < dist[v]) {
-                    dist[v] = dist[u] + adjacency_matrix[u][v];
+            if(u == target) break; // wczesne zakonczenie
+            
+            for(int e = csr_offsets[u]; e < csr_offsets[u + 1]; e++) {
+                int v = csr_targets[e];
+                int weight = csr_weights[e];
+                
+                if(!settled[v] && dist[u] + weight < dist[v]) {
+                    dist[v] = dist[u] + weight;
                     parent[v] = u;
+                    
+                    if(heap.isInHeap(v)) {
+                        heap.decreaseKey(v, dist[v]);
+                    } else {
+                        heap.insert(v, dist[v]);
+                    }
                 }
             }
         }
         
-        auto end_time = std::chrono::high_resolution_clock::now();
-        auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(end_time - start_time);
-        double seconds = duration.count() / 1000000000.0;
+        int result = (target >= 0) ? dist[target] : 0;
         
         delete[] dist;
-        delete[] sptSet;
-        delete[] parent;
+        delete[] settled;
         
-        return seconds;
+        return result;
     }
     
-    double executeDijkstraList() {
-        auto start_time = std::chrono::high_resolution_clock::now();
+    // Dwukierunkowy Dijkstra: przeszukiwanie od zrodla po CSR wprzod i od celu po CSR odwroconym.
+    // Konczy, gdy suma minimow obu kopcow nie moze juz poprawic najlepszej znalezionej sciezki.
+    // path musi miec miejsce na vertices elementow; path_length = 0 gdy cel nieosiagalny.
+    int dijkstraBidirectional(int source, int target, int* path, int& path_length, int& settled_count) {
+        buildReverseCSR();
         
-        int* dist = new int[vertices];
-        bool* sptSet = new bool[vertices];
-        int* parent = new int[vertices];
+        int* dist_f = new int[vertices];
+        int* dist_b = new int[vertices];
+        int* parent_f = new int[vertices];
+        int* parent_b = new int[vertices];
+        bool* settled_f = new bool[vertices];
+        bool* settled_b = new bool[vertices];
+        MinHeap heap_f(vertices);
+        MinHeap heap_b(vertices);
         
         for(int i = 0; i < vertices; i++) {
-            dist[i] = INT_MAX;
-            sptSet[i] = false;
-            parent[i] = -1;
+            dist_f[i] = dist_b[i] = INT_MAX;
+            parent_f[i] = parent_b[i] = -1;
+            settled_f[i] = settled_b[i] = false;
         }
         
-        dist[start_vertex] = 0;
+        dist_f[source] = 0;
+        dist_b[target] = 0;
+        heap_f.insert(source, 0);
+        heap_b.insert(target, 0);
         
-        for(int count = 0; count < vertices - 1; count++) {
-            int u = minDistance(dist, sptSet);
-            sptSet[u] = true;
+        long long best = (source == target) ? 0 : LLONG_MAX;
+        int meet = (source == target) ? source : -1;
+        settled_count = 0;
+        
+        while(!heap_f.isEmpty() && !heap_b.isEmpty()) {
+            long long top_f = heap_f.minKey();
+            long long top_b = heap_b.minKey();
+            if(top_f + top_b >= best) break;
             
-            for(int i = 0; i < list_sizes[u]; i++) {
-                int v = adjacency_list[u][i * 2];
-                int weight = adjacency_list[u][i * 2 + 1];
+            // Rozwijamy strone z mniejszym minimum w kopcu
+            bool forward = top_f <= top_b;
+            MinHeap& heap = forward ? heap_f : heap_b;
+            int* dist = forward ? dist_f : dist_b;
+            int* other_dist = forward ? dist_b : dist_f;
+            int* parent = forward ? parent_f : parent_b;
+            bool* settled = forward ? settled_f : settled_b;
+            const int* offsets = forward ? csr_offsets : rcsr_offsets;
+            const int* targets = forward ? csr_targets : rcsr_targets;
+            const int* weights = forward ? csr_weights : rcsr_weights;
+            
+            int u = heap.extractMin().vertex;
+            settled[u] = true;
+            settled_count++;
+            
+            for(int e = offsets[u]; e < offsets[u + 1]; e++) {
+                int v = targets[e];
+                int weight = weights[e];
                 
-                if(!sptSet[v] && dist[u] != INT_MAX && dist[u] + weight < dist[v]) {
+                if(!settled[v] && dist[u] + weight < dist[v]) {
                     dist[v] = dist[u] + weight;
                     parent[v] = u;
+                    
+                    if(heap.isInHeap(v)) {
+                        heap.decreaseKey(v, dist[v]);
+                    } else {
+                        heap.insert(v, dist[v]);
+                    }
+                }
+                
+                // Polaczenie obu przeszukiwan przez v
+                if(dist[v] != INT_MAX && other_dist[v] != INT_MAX &&
+                   (long long)dist[v] + other_dist[v] < best) {
+                    best = (long long)dist[v] + other_dist[v];
+                    meet = v;
                 }
             }
         }
         
-        auto end_time = std::chrono::high_resolution_clock::now();
-        auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(end_time - start_time);
-        double seconds = duration.count() / 1000000000.0;
+        path_length = 0;
+        if(meet != -1) {
+            // Zrodlo -> meet (odwrocone parent_f), potem meet -> cel po parent_b
+            for(int v = meet; v != -1; v = parent_f[v]) {
+                path[path_length++] = v;
+            }
+            for(int i = 0; i < path_length / 2; i++) {
+                int temp = path[i];
+                path[i] = path[path_length - 1 - i];
+                path[path_length - 1 - i] = temp;
+            }
+            for(int v = parent_b[meet]; v != -1; v = parent_b[v]) {
+                path[path_length++] = v;
+            }
+        }
         
-        delete[] dist;
-        delete[] sptSet;
-        delete[] parent;
+        int result = (meet != -1) ? (int)best : INT_MAX;
+        
+        delete[] dist_f;
+        delete[] dist_b;
+        delete[] parent_f;
+        delete[] parent_b;
+        delete[] settled_f;
+        delete[] settled_b;
         
-        return seconds;
+        return result;
     }
     
-    void performPerformanceTests() {
-        std::cout << "\n=== TESTY WYDAJNOSCI ALGORYTMU DIJKSTRY ===" << std::endl;
-        std::cout << "Zgodnie z wymaganiami projektu:" << std::endl;
-        std::cout << "- 7 rozmiarow grafow" << std::endl;
-        std::cout << "- 3 gestosci: 20%, 60%, 99%" << std::endl;
-        std::cout << "- 50 instancji dla kazdego zestawu" << std::endl;
-        std::cout << "- Wyniki usrednione\n" << std::endl;
+    void pointToPointQuery() {
+        int source, target;
+        std::cout << "Podaj wierzcholek startowy: ";
+        std::cin >> source;
+        std::cout << "Podaj wierzcholek docelowy: ";
+        std::cin >> target;
         
-        int test_sizes[] = {500,1000, 2000,3000,3500,4000,5000};
-        int densities[] = {20, 60, 99};
-        int num_tests = 50;
+        if(source < 0 || source >= vertices || target < 0 || target >= vertices) {
+            std::cout << "Nieprawidlowy wierzcholek!" << std::endl;
+            return;
+        }
         
-        for(int size_idx = 0; size_idx < 7; size_idx++) {
-            int v = test_sizes[size_idx];
-            
-            for(int dens_idx = 0; dens_idx < 3; dens_idx++) {
-                int density = densities[dens_idx];
-                
-                double total_time_matrix = 0.0;
-                double total_time_list = 0.0;
-                
-                std::cout << "Testowanie " << v << " wierzcholkow, gestosc " << density << "%... ";
-                std::cout.flush();
-                
-                for(int test = 0; test < num_tests; test++) {
-                    generateRandomForTesting(v, density);
-                    
-                    double time_matrix = executeDijkstraMatrix();
-                    total_time_matrix += time_matrix;
-                    
-                    double time_list = executeDijkstraList();
-                    total_time_list += time_list;
-                }
-                
-                double avg_time_matrix = total_time_matrix / num_tests;
-                double avg_time_list = total_time_list / num_tests;
-                
-                std::cout << "GOTOWE" << std::endl;
-                
-                std::cout << "ilosc wierzcholkow = " << v << " gestosc = " << density << " reprezentacja = macierzowa" << std::endl;
-                std::cout << "czas w sekundach = " << std::fixed << std::setprecision(6) << avg_time_matrix << std::endl;
-                std::cout << std::endl;
-                
-                std::cout << "ilosc wierzcholkow = " << v << " gestosc = " << density << " reprezentacja = listowa" << std::endl;
-                std::cout << "czas w sekundach = " << std::fixed << std::setprecision(6) << avg_time_list << std::endl;
-                std::cout << std::endl;
+        // Numery z wejscia -> biezaca numeracja
+        int source_label = source, target_label = target;
+        source = current_id[source];
+        target = current_id[target];
+        
+        int* parent = new int[vertices];
+        int* path = new int[vertices];
+        int path_length = 0;
+        int settled_full, settled_early, settled_bidir;
+        
+        auto t0 = std::chrono::high_resolution_clock::now();
+        dijkstraPointToPoint(source, -1, parent, settled_full);
+        auto t1 = std::chrono::high_resolution_clock::now();
+        int dist_early = dijkstraPointToPoint(source, target, parent, settled_early);
+        auto t2 = std::chrono::high_resolution_clock::now();
+        int dist_bidir = dijkstraBidirectional(source, target, path, path_length, settled_bidir);
+        auto t3 = std::chrono::high_resolution_clock::now();
+        
+        std::cout << "\nZapytanie " << source_label << " -> " << target_label << ":" << std::endl;
+        if(dist_bidir == INT_MAX) {
+            std::cout << "NIEOSIAGALNY" << std::endl;
+        } else {
+            std::cout << "koszt = " << dist_bidir << ", sciezka: ";
+            for(int j = 0; j < path_length; j++) {
+                std::cout << original_id[path[j]];
+                if(j < path_length - 1) std::cout << " -> ";
             }
+            std::cout << std::endl;
+        }
+        if(dist_early != dist_bidir) {
+            std::cout << "BLAD: wyniki wariantow roznia sie (" << dist_early << " vs " << dist_bidir << ")" << std::endl;
         }
         
-        std::cout << "=== KONIEC TESTOW WYDAJNOSCI ===" << std::endl;
+        std::cout << std::fixed << std::setprecision(6);
+        std::cout << "Pelny Dijkstra:        zatwierdzonych = " << settled_full << ", czas = "
+                  << std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count() / 1000000000.0 << " s" << std::endl;
+        std::cout << "Wczesne zakonczenie:   zatwierdzonych = " << settled_early << ", czas = "
+                  << std::chrono::duration_cast<std::chrono::nanoseconds>(t2 - t1).count() / 1000000000.0 << " s" << std::endl;
+        std::cout << "Dwukierunkowy:         zatwierdzonych = " << settled_bidir << ", czas = "
+                  << std::chrono::duration_cast<std::chrono::nanoseconds>(t3 - t2).count() / 1000000000.0 << " s" << std::endl;
+        
+        delete[] parent;
+        delete[] path;
     }
-};
-
-int main() {
-    srand(time(nullptr));
-    Graph* graph = nullptr;
-    int choice;
-    
-    std::cout << "=== ALGORYTM DIJKSTRY - NAJKROTSZE SCIEZKI ===" << std::endl;
-    
-    do {
-        std::cout << "\n--- MENU ---" << std::endl;
-        std::cout << "1. Wczytaj z pliku" << std::endl;
-        std::cout << "2. Wygeneruj graf losowo" << std::endl;
-        std::cout << "3. Wyswietl listowo i macierzowo" << std::endl;
-        std::cout << "4. Algorytm Dijkstry - macierzowo" << std::endl;
-        std::cout << "5. Algorytm Dijkstry - listowo" << std::endl;
-        std::cout << "6. Testy wydajnosci (zgodnie z wymaganiami)" << std::endl;
-        std::cout << "0. Wyjscie" << std::endl;
+    
+    // Porownanie nakladu pracy na losowych parach (zrodlo, cel)
+    void pointToPointComparison() {
+        int num_queries;
+        std::cout << "Podaj liczbe losowych par (zrodlo, cel): ";
+        std::cin >> num_queries;
+        if(num_queries <= 0) return;
+        
+        int* parent = new int[vertices];
+        int* path = new int[vertices];
+        int path_length;
+        long long settled_full = 0, settled_early = 0, settled_bidir = 0;
+        double time_full = 0.0, time_early = 0.0, time_bidir = 0.0;
+        int mismatches = 0;
+        
+        for(int q = 0; q < num_queries; q++) {
+            int source = rand() % vertices;
+            int target = rand() % vertices;
+            int count;
+            
+            auto t0 = std::chrono::high_resolution_clock::now();
+            dijkstraPointToPoint(source, -1, parent, count);
+            settled_full += count;
+            auto t1 = std::chrono::high_resolution_clock::now();
+            int dist_early = dijkstraPointToPoint(source, target, parent, count);
+            settled_early += count;
+            auto t2 = std::chrono::high_resolution_clock::now();
+            int dist_bidir = dijkstraBidirectional(source, target, path, path_length, count);
+            settled_bidir += count;
+            auto t3 = std::chrono::high_resolution_clock::now();
+            
+            time_full += std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count() / 1000000000.0;
+            time_early += std::chrono::duration_cast<std::chrono::nanoseconds>(t2 - t1).count() / 1000000000.0;
+            time_bidir += std::chrono::duration_cast<std::chrono::nanoseconds>(t3 - t2).count() / 1000000000.0;
+            
+            if(dist_early != dist_bidir) mismatches++;
+        }
+        
+        std::cout << "\nSrednio na zapytanie (" << num_queries << " par, " << vertices << " wierzcholkow):" << std::endl;
+        std::cout << std::fixed << std::setprecision(6);
+        std::cout << "Pelny Dijkstra:        zatwierdzonych = " << (double)settled_full / num_queries
+                  << ", czas = " << time_full / num_queries << " s" << std::endl;
+        std::cout << "Wczesne zakonczenie:   zatwierdzonych = " << (double)settled_early / num_queries
+                  << ", czas = " << time_early / num_queries << " s" << std::endl;
+        std::cout << "Dwukierunkowy:         zatwierdzonych = " << (double)settled_bidir / num_queries
+                  << ", czas = " << time_bidir / num_queries << " s" << std::endl;
+        if(mismatches > 0) {
+            std::cout << "BLAD: " << mismatches << " zapytan z roznym wynikiem!" << std::endl;
+        }
+        
+        delete[] parent;
+        delete[] path;
+    }
+    
+    void contractionHierarchyMenu() {
+        dropStaleHierarchy(graph);
+        int option;
+        std::cout << "\nHierarchia skrotow (CH):" << std::endl;
+        std::cout << "1. Zbuduj hierarchie dla biezacego grafu" << std::endl;
+        std::cout << "2. Zapisz hierarchie do pliku" << std::endl;
+        std::cout << "3. Wczytaj hierarchie z pliku" << std::endl;
+        std::cout << "4. Zapytanie punkt-punkt (CH)" << std::endl;
         std::cout << "Wybierz opcje: ";
-        std::cin >> choice;
+        std::cin >> option;
         
-        switch(choice) {
+        switch(option) {
             case 1: {
-                std::string filename;
-                std::cout << "Podaj nazwe pliku: ";
-                std::cin >> filename;
+                buildCSR();
+                ContractionHierarchy* built = new ContractionHierarchy();
                 
-                if(graph) delete graph;
-                graph = new Graph(10);
-                graph->loadFromFile(filename);
+                auto start_time = std::chrono::high_resolution_clock::now();
+                built->build(vertices, csr_offsets, csr_targets, csr_weights);
+                auto end_time = std::chrono::high_resolution_clock::now();
+                rememberHierarchy(built, graph);
+                double seconds = std::chrono::duration_cast<std::chrono::nanoseconds>(end_time - start_time).count() / 1000000000.0;
+                
+                std::cout << "Hierarchia zbudowana: " << hierarchy->getShortcutCount() << " skrotow, czas = "
+                          << std::fixed << std::setprecision(6) << seconds << " sekund" << std::endl;
                 break;
             }
             case 2: {
-                int vertices, density;
-                std::cout << "Podaj liczbe wierzcholkow: ";
-                std::cin >> vertices;
-                std::cout << "Podaj gestosc grafu (w %): ";
-                std::cin >> density;
-                
-                if(graph) delete graph;
-                graph = new Graph(vertices);
-                graph->generateRandom(vertices, density);
+                if(!hierarchy) {
+                    std::cout << "Brak hierarchii! Zbuduj lub wczytaj hierarchie." << std::endl;
+                    break;
+                }
+                std::string filename;
+                std::cout << "Podaj nazwe pliku: ";
+                std::cin >> filename;
+                if(hierarchy->save(filename)) {
+                    std::cout << "Hierarchia zapisana do pliku " << filename << std::endl;
+                }
                 break;
             }
             case 3: {
-                if(graph) {
-                    graph->displayMatrix();
-                    graph->displayList();
+                std::string filename;
+                std::cout << "Podaj nazwe pliku: ";
+                std::cin >> filename;
+                
+                ContractionHierarchy* loaded = new ContractionHierarchy();
+                if(!loaded->load(filename)) {
+                    delete loaded;
+                } else if(loaded->getVertices() != vertices) {
+                    std::cout << "Blad: Hierarchia ma " << loaded->getVertices() << " wierzcholkow, graf ma " << vertices << std::endl;
+                    delete loaded;
                 } else {
-                    std::cout << "Brak grafu! Wczytaj lub wygeneruj graf." << std::endl;
+                    rememberHierarchy(loaded, graph);
+                    std::cout << "Hierarchia wczytana (" << hierarchy->getShortcutCount() << " skrotow)" << std::endl;
                 }
                 break;
             }
             case 4: {
-                if(graph) {
-                    graph->dijkstraMatrix();
-                } else {
-                    std::cout << "Brak grafu! Wczytaj lub wygeneruj graf." << std::endl;
+                if(!hierarchy) {
+                    std::cout << "Brak hierarchii! Zbuduj lub wczytaj hierarchie." << std::endl;
+                    break;
                 }
-                break;
-            }
-            case 5: {
-                if(graph) {
-                    graph->dijkstraList();
-                } else {
-                    std::cout << "Brak grafu! Wczytaj lub wygeneruj graf." << std::endl;
-                }
-                break;
-            }
-            case 6: {
-                std::cout << "Uwaga: Testy wydajnosci moga potrwac kilka minut..." << std::endl;
-                std::cout << "Czy kontynuowac? (t/n): ";
-                char confirm;
-                std::cin >> confirm;
-                if(confirm == 't' || confirm == 'T') {
-                    if(graph) delete graph;
-                    graph = new Graph(10);
-                    graph->performPerformanceTests();
+                int source, target, settled;
+                std::cout << "Podaj wierzcholek startowy: ";
+                std::cin >> source;
+                std::cout << "Podaj wierzcholek docelowy: ";
+                std::cin >> target;
+                if(source < 0 || source >= vertices || target < 0 || target >= vertices) {
+                    std::cout << "Nieprawidlowy wierzcholek!" << std::endl;
+                    break;
                 }
+                
+                int dist = hierarchy->query(current_id[source], current_id[target], settled);
+                std::cout << "Zapytanie " << source << " -> " << target << ": ";
+                if(dist == INT_MAX) std::cout << "NIEOSIAGALNY";
+                else std::cout << "koszt = " << dist;
+                std::cout << " (zatwierdzonych = " << settled << ")" << std::endl;
                 break;
             }
-            case 0:
-                std::cout << "Koniec programu." << std::endl;
-                break;
             default:
                 std::cout << "Nieprawidlowa opcja!" << std::endl;
         }
-    } while(choice != 0);
+    }
+    
+    // Porownanie CH z Dijkstra punkt-punkt na tych samych wygenerowanych instancjach
+    void contractionHierarchyBenchmark() {
+        int v, density, num_instances, num_queries;
+        std::cout << "Podaj liczbe wierzcholkow: ";
+        std::cin >> v;
+        std::cout << "Podaj gestosc grafu (w %): ";
+        std::cin >> density;
+        std::cout << "Podaj liczbe instancji: ";
+        std::cin >> num_instances;
+        std::cout << "Podaj liczbe zapytan na instancje: ";
+        std::cin >> num_queries;
+        if(v <= 1 || num_instances <= 0 || num_queries <= 0) return;
+        
+        double total_build = 0.0, total_ch = 0.0, total_dijkstra = 0.0;
+        long long total_shortcuts = 0, settled_ch = 0, settled_dijkstra = 0;
+        int mismatches = 0;
+        int* parent = new int[v];
+        
+        for(int instance = 0; instance < num_instances; instance++) {
+            graph.generateRandomForTesting(v, density, GRAPH_DIRECTED);
+            buildCSR();
+            
+            ContractionHierarchy* built = new ContractionHierarchy();
+            auto start_time = std::chrono::high_resolution_clock::now();
+            built->build(vertices, csr_offsets, csr_targets, csr_weights);
+            auto end_time = std::chrono::high_resolution_clock::now();
+            rememberHierarchy(built, graph);
+            total_build += std::chrono::duration_cast<std::chrono::nanoseconds>(end_time - start_time).count() / 1000000000.0;
+            total_shortcuts += hierarchy->getShortcutCount();
+            
+            for(int q = 0; q < num_queries; q++) {
+                int source = rand() % vertices;
+                int target = rand() % vertices;
+                int count;
+                
+                auto t0 = std::chrono::high_resolution_clock::now();
+                int dist_ch = hierarchy->query(source, target, count);
+                settled_ch += count;
+                auto t1 = std::chrono::high_resolution_clock::now();
+                int dist_plain = dijkstraPointToPoint(source, target, parent, count);
+                settled_dijkstra += count;
+                auto t2 = std::chrono::high_resolution_clock::now();
+                
+                total_ch += std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count() / 1000000000.0;
+                total_dijkstra += std::chrono::duration_cast<std::chrono::nanoseconds>(t2 - t1).count() / 1000000000.0;
+                
+                if(dist_ch != dist_plain) mismatches++;
+            }
+        }
+        
+        long long total_queries = (long long)num_instances * num_queries;
+        std::cout << "\nilosc wierzcholkow = " << v << " gestosc = " << density << std::endl;
+        std::cout << std::fixed << std::setprecision(6);
+        std::cout << "Preprocessing CH: sredni czas = " << total_build / num_instances << " s, srednio skrotow = "
+                  << (double)total_shortcuts / num_instances << std::endl;
+        std::cout << "Zapytanie CH:       czas = " << total_ch / total_queries << " s, zatwierdzonych = "
+                  << (double)settled_ch / total_queries << std::endl;
+        std::cout << "Zapytanie Dijkstra: czas = " << total_dijkstra / total_queries << " s, zatwierdzonych = "
+                  << (double)settled_dijkstra / total_queries << std::endl;
+        if(total_ch > 0) {
+            std::cout << "Przyspieszenie zapytan: " << std::setprecision(2) << total_dijkstra / total_ch << "x" << std::endl;
+        }
+        if(mismatches > 0) {
+            std::cout << "BLAD: " << mismatches << " zapytan z roznym wynikiem!" << std::endl;
+        }
+        
+        delete[] parent;
+    }
+    
+    
+    // Dodatkowe silniki porownywane z wynikiem referencyjnym trybu weryfikacji: kopiec,
+    // zapytania wsadowe oraz zapytania punkt-punkt, dwukierunkowe i CH do wybranych celow
+    static const int VERIFY_TARGETS = 8;      // liczba celow zapytan punkt-punkt na instancje
+    static const int VERIFY_CH_LIMIT = 1000;  // hierarchia skrotow budowana tylko dla mniejszych grafow
+    
+    void verifyEngines(VerificationContext& ctx, const int* reference) {
+        int* dist = new int[vertices];
+        int* parent = new int[vertices];
+        int* path = new int[vertices];
+        bool* settled = new bool[vertices];
+        MinHeap heap(vertices);
+        
+        dijkstraHeap(start_vertex, dist, parent, settled, heap);
+        checkDistances(ctx, "dijkstra: kopiec", reference, dist, vertices);
+        
+        BatchResult* batch = batchDijkstra(&start_vertex, 1, nullptr, 0, defaultThreadCount());
+        checkDistances(ctx, "dijkstra: zapytania wsadowe", reference, batch->dist, vertices);
+        delete batch;
+        
+        ContractionHierarchy* ch = nullptr;
+        if(vertices <= VERIFY_CH_LIMIT) {
+            buildCSR();
+            ch = new ContractionHierarchy();
+            ch->build(vertices, csr_offsets, csr_targets, csr_weights);
+        }
+        int num_targets = vertices < VERIFY_TARGETS ? vertices : VERIFY_TARGETS;
+        for(int i = 0; i < num_targets; i++) {
+            int target = (int)((long long)i * vertices / num_targets);
+            std::string suffix = " (cel " + std::to_string(target) + ")";
+            int settled_count, path_length;
+            checkValue(ctx, "dijkstra: punkt-punkt" + suffix, reference[target],
+                       dijkstraPointToPoint(start_vertex, target, parent, settled_count));
+            checkValue(ctx, "dijkstra: dwukierunkowy" + suffix, reference[target],
+                       dijkstraBidirectional(start_vertex, target, path, path_length, settled_count));
+            if(ch) {
+                checkValue(ctx, "dijkstra: hierarchia skrotow" + suffix, reference[target],
+                           ch->query(start_vertex, target, settled_count));
+            }
+        }
+        delete ch;
+        
+        delete[] dist;
+        delete[] parent;
+        delete[] path;
+        delete[] settled;
+    }
+};
+
+// Wspolne przebiegi obu silnikow; heap - kopiec zamiast liniowego wyszukiwania minimum
+static double dijkstraTimedVariant(Graph& graph, int representation, bool heap, int* dist, int* parent) {
+    DijkstraSolver solver(graph);
+    if(heap) return solver.timedDijkstraHeap(dist, parent);
+    return solver.timedDijkstra(representation, dist, parent);
+}
+
+static void dijkstraRunVariant(Graph& graph, int representation, bool heap) {
+    std::cout << "\nAlgorytm Dijkstry" << (heap ? " z kopcem" : "") << " - reprezentacja "
+              << representationName(representation) << ":" << std::endl;
+    std::cout << "Wierzcholek startowy: " << graph.getOriginalId()[graph.getStartVertex()] << std::endl;
+    
+    int* dist = new int[graph.getVertices()];
+    int* parent = new int[graph.getVertices()];
+    double seconds = dijkstraTimedVariant(graph, representation, heap, dist, parent);
+    
+    printShortestPaths(graph, dist, parent);
+    std::cout << "Czas wykonania (reprezentacja " << representationName(representation) << "): "
+              << std::fixed << std::setprecision(6) << seconds << " sekund" << std::endl;
+    
+    delete[] dist;
+    delete[] parent;
+}
+
+static double dijkstraExecuteVariant(Graph& graph, int representation, AlgorithmOutput* output, bool heap) {
+    int* dist = new int[graph.getVertices()];
+    int* parent = new int[graph.getVertices()];
+    double seconds = dijkstraTimedVariant(graph, representation, heap, dist, parent);
+    
+    // Odleglosci dla trybu weryfikacji (poza mierzonym czasem)
+    if(output) {
+        for(int i = 0; i < graph.getVertices(); i++) output->dist[i] = dist[i];
+        if(output->parent) {
+            for(int i = 0; i < graph.getVertices(); i++) output->parent[i] = parent[i];
+        }
+        output->negative_cycle = false;
+    }
+    
+    delete[] dist;
+    delete[] parent;
+    return seconds;
+}
+
+static void dijkstraRun(Graph& graph, int representation) {
+    dijkstraRunVariant(graph, representation, false);
+}
+
+static double dijkstraExecute(Graph& graph, int representation, AlgorithmOutput* output) {
+    return dijkstraExecuteVariant(graph, representation, output, false);
+}
+
+static void dijkstraHeapRun(Graph& graph, int representation) {
+    dijkstraRunVariant(graph, representation, true);
+}
+
+static double dijkstraHeapExecute(Graph& graph, int representation, AlgorithmOutput* output) {
+    return dijkstraExecuteVariant(graph, representation, output, true);
+}
+
+static void dijkstraVerify(Graph& graph, VerificationContext& ctx, const AlgorithmOutput& reference) {
+    DijkstraSolver solver(graph);
+    solver.verifyEngines(ctx, reference.dist);
+}
+
+static void dijkstraMenu(Graph& graph) {
+    int option;
+    std::cout << "\nAlgorytm Dijkstry - opcje dodatkowe:" << std::endl;
+    std::cout << "1. Zapytania wsadowe (wiele zrodel, rownolegle)" << std::endl;
+    std::cout << "2. Zapytanie punkt-punkt (wczesne zakonczenie, dwukierunkowy)" << std::endl;
+    std::cout << "3. Porownanie wariantow punkt-punkt (losowe pary)" << std::endl;
+    std::cout << "4. Hierarchia skrotow (budowa, zapis, odczyt, zapytania)" << std::endl;
+    std::cout << "5. Testy wydajnosci hierarchii skrotow" << std::endl;
+    std::cout << "6. Naprawa sciezek po zmianach krawedzi (przyrostowo)" << std::endl;
+    std::cout << "Wybierz opcje: ";
+    std::cin >> option;
     
-    if(graph) delete graph;
-    return 0;
+    DijkstraSolver solver(graph);
+    switch(option) {
+        case 1: solver.batchQueries(); break;
+        case 2: solver.pointToPointQuery(); break;
+        case 3: solver.pointToPointComparison(); break;
+        case 4: solver.contractionHierarchyMenu(); break;
+        case 5: solver.contractionHierarchyBenchmark(); break;
+        case 6: dynamicShortestPathsMenu(graph, *findAlgorithm("dijkstra"), false); break;
+        default: std::cout << "Nieprawidlowa opcja!" << std::endl;
+    }
 }
+
+static const int dijkstra_test_sizes[] = {500, 1000, 2000, 3000, 3500, 4000, 5000};
+
+static const AlgorithmInfo dijkstra_info = {
+    "dijkstra", "Algorytm Dijkstry (najkrotsze sciezki)", GRAPH_DIRECTED, true, REP_MASK_ALL,
+    dijkstra_test_sizes, 7, 50,
+    dijkstraRun, dijkstraExecute, dijkstraVerify, dijkstraMenu
+};
+
+// Kopiec na liscie jako osobny silnik - model kosztu trybu automatycznego wybiera miedzy
+// liniowym wyszukiwaniem minimum a kopcem; zgodnosc wynikow sprawdza weryfikacja klasycznego
+static const AlgorithmInfo dijkstra_heap_info = {
+    "dijkstra-heap", "Algorytm Dijkstry z kopcem (najkrotsze sciezki)", GRAPH_DIRECTED, true, REP_MASK_LIST,
+    dijkstra_test_sizes, 7, 50,
+    dijkstraHeapRun, dijkstraHeapExecute, nullptr, dijkstraMenu
+};
+
+static AlgorithmRegistrar dijkstra_registrar(dijkstra_info);
+static AlgorithmRegistrar dijkstra_heap_registrar(dijkstra_heap_info);
@@ -0,0 +1,664 @@
+#include "DynamicMST.h"
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <climits>
+#include <cstdlib>
+
+// ---------------------------------------------------------------------------
+// Drzewo link-cut
+
+LinkCutTree::LinkCutTree(int n) : nodes(0), left(nullptr), right(nullptr), parent(nullptr), value(nullptr),
+                                  max_node(nullptr), reversed(nullptr), stack(nullptr) {
+    resize(n);
+}
+
+LinkCutTree::~LinkCutTree() {
+    delete[] left;
+    delete[] right;
+    delete[] parent;
+    delete[] value;
+    delete[] max_node;
+    delete[] reversed;
+    delete[] stack;
+}
+
+void LinkCutTree::resize(int n) {
+    if(n <= nodes) return;
+    int* new_left = new int[n];
+    int* new_right = new int[n];
+    int* new_parent = new int[n];
+    int* new_value = new int[n];
+    int* new_max = new int[n];
+    bool* new_reversed = new bool[n];
+    
+    for(int i = 0; i < n; i++) {
+        if(i < nodes) {
+            new_left[i] = left[i];
+            new_right[i] = right[i];
+            new_parent[i] = parent[i];
+            new_value[i] = value[i];
+            new_max[i] = max_node[i];
+            new_reversed[i] = reversed[i];
+        } else {
+            new_left[i] = new_right[i] = new_parent[i] = -1;
+            new_value[i] = INT_MIN;
+            new_max[i] = i;
+            new_reversed[i] = false;
+        }
+    }
+    
+    delete[] left;
+    delete[] right;
+    delete[] parent;
+    delete[] value;
+    delete[] max_node;
+    delete[] reversed;
+    delete[] stack;
+    left = new_left;
+    right = new_right;
+    parent = new_parent;
+    value = new_value;
+    max_node = new_max;
+    reversed = new_reversed;
+    stack = new int[n];
+    nodes = n;
+}
+
+// Korzen drzewa splay: ojciec jest tylko wskaznikiem sciezki (nie ma x jako dziecka)
+bool LinkCutTree::isRoot(int x) const {
+    int p = parent[x];
+    return p < 0 || (left[p] != x && right[p] != x);
+}
+
+void LinkCutTree::update(int x) {
+    int best = x;
+    if(left[x] >= 0 && value[max_node[left[x]]] > value[best]) best = max_node[left[x]];
+    if(right[x] >= 0 && value[max_node[right[x]]] > value[best]) best = max_node[right[x]];
+    max_node[x] = best;
+}
+
+void LinkCutTree::pushDown(int x) {
+    if(!reversed[x]) return;
+    int temp = left[x];
+    left[x] = right[x];
+    right[x] = temp;
+    if(left[x] >= 0) reversed[left[x]] = !reversed[left[x]];
+    if(right[x] >= 0) reversed[right[x]] = !reversed[right[x]];
+    reversed[x] = false;
+}
+
+void LinkCutTree::rotate(int x) {
+    int p = parent[x];
+    int g = parent[p];
+    bool parent_is_root = isRoot(p);
+    
+    if(left[p] == x) {
+        left[p] = right[x];
+        if(right[x] >= 0) parent[right[x]] = p;
+        right[x] = p;
+    } else {
+        right[p] = left[x];
+        if(left[x] >= 0) parent[left[x]] = p;
+        left[x] = p;
+    }
+    parent[p] = x;
+    parent[x] = g;
+    if(!parent_is_root) {
+        if(left[g] == p) left[g] = x;
+        else right[g] = x;
+    }
+    update(p);
+    update(x);
+}
+
+void LinkCutTree::splay(int x) {
+    // Zalegle odwrocenia od korzenia drzewa splay w dol do x
+    int top = 0;
+    stack[top++] = x;
+    for(int y = x; !isRoot(y); y = parent[y]) stack[top++] = parent[y];
+    while(top > 0) pushDown(stack[--top]);
+    
+    while(!isRoot(x)) {
+        int p = parent[x];
+        if(!isRoot(p)) {
+            int g = parent[p];
+            if((left[g] == p) == (left[p] == x)) rotate(p);
+            else rotate(x);
+        }
+        rotate(x);
+    }
+}
+
+void LinkCutTree::access(int x) {
+    int last = -1;
+    for(int y = x; y >= 0; y = parent[y]) {
+        splay(y);
+        right[y] = last;
+        update(y);
+        last = y;
+    }
+    splay(x);
+}
+
+void LinkCutTree::makeRoot(int x) {
+    access(x);
+    reversed[x] = !reversed[x];
+}
+
+int LinkCutTree::findRoot(int x) {
+    access(x);
+    while(true) {
+        pushDown(x);
+        if(left[x] < 0) break;
+        x = left[x];
+    }
+    splay(x);
+    return x;
+}
+
+void LinkCutTree::setValue(int x, int weight) {
+    access(x);
+    value[x] = weight;
+    update(x);
+}
+
+void LinkCutTree::link(int x, int y) {
+    makeRoot(x);
+    parent[x] = y;
+}
+
+// x i y musza byc sasiadami w lesie
+void LinkCutTree::cut(int x, int y) {
+    makeRoot(x);
+    access(y);
+    if(left[y] >= 0) {
+        parent[left[y]] = -1;
+        left[y] = -1;
+        update(y);
+    }
+}
+
+bool LinkCutTree::connected(int x, int y) {
+    return findRoot(x) == findRoot(y);
+}
+
+int LinkCutTree::pathMax(int x, int y) {
+    makeRoot(x);
+    access(y);
+    return max_node[y];
+}
+
+// ---------------------------------------------------------------------------
+// Dynamiczne MST
+
+// Union-Find do sprawdzenia, czy drzewo startowe rozpina kazda skladowa
+static int findSet(int* parent, int x) {
+    while(parent[x] != x) {
+        parent[x] = parent[parent[x]];
+        x = parent[x];
+    }
+    return x;
+}
+
+DynamicMST::DynamicMST(Graph& graph, const Edge* tree, int tree_count)
+    : vertices(graph.getVertices()), capacity(graph.getEdgeCount() + graph.getVertices() + 16), slot_count(0),
+      free_count(0), forest(graph.getVertices() + graph.getEdgeCount() + graph.getVertices() + 16),
+      total_weight(0), tree_edges(0), mark_stamp(0) {
+    edges = new DynamicEdge[capacity];
+    free_slots = new int[capacity];
+    incident = new int*[vertices];
+    incident_size = new int[vertices];
+    incident_capacity = new int[vertices];
+    int** adjacency_list = graph.getList();
+    int* list_sizes = graph.getListSizes();
+    for(int v = 0; v < vertices; v++) {
+        incident_capacity[v] = list_sizes[v] + 4;
+        incident[v] = new int[incident_capacity[v]];
+        incident_size[v] = 0;
+    }
+    mark = new int[vertices];
+    queue_first = new int[vertices];
+    queue_second = new int[vertices];
+    for(int v = 0; v < vertices; v++) mark[v] = 0;
+    
+    // Krawedzie grafu (wiersze listy sasiedztwa, kazda krawedz raz)
+    for(int u = 0; u < vertices; u++) {
+        for(int j = 0; j < list_sizes[u]; j++) {
+            int v = adjacency_list[u][j * 2];
+            if(u < v) allocateEdge(u, v, adjacency_list[u][j * 2 + 1]);
+        }
+    }
+    
+    // Las startowy z wyniku Prima / Kruskala
+    int* component = new int[vertices];
+    for(int v = 0; v < vertices; v++) component[v] = v;
+    for(int i = 0; i < tree_count; i++) {
+        int e = findEdge(tree[i].start, tree[i].end);
+        if(e < 0 || edges[e].in_tree) continue;
+        int a = findSet(component, tree[i].start), b = findSet(component, tree[i].end);
+        if(a == b) continue;
+        component[a] = b;
+        linkEdge(e);
+    }
+    
+    // Prim rozpina tylko skladowa startu - pozostale skladowe dolaczane jak przy wstawianiu
+    for(int e = 0; e < slot_count; e++) {
+        if(edges[e].in_tree) continue;
+        if(findSet(component, edges[e].start) != findSet(component, edges[e].end)) reconnect(e);
+    }
+    delete[] component;
+}
+
+DynamicMST::~DynamicMST() {
+    for(int v = 0; v < vertices; v++) delete[] incident[v];
+    delete[] incident;
+    delete[] incident_size;
+    delete[] incident_capacity;
+    delete[] edges;
+    delete[] free_slots;
+    delete[] mark;
+    delete[] queue_first;
+    delete[] queue_second;
+}
+
+void DynamicMST::addIncident(int vertex, int e, int& position) {
+    if(incident_size[vertex] == incident_capacity[vertex]) {
+        int new_capacity = incident_capacity[vertex] * 2;
+        int* grown = new int[new_capacity];
+        for(int i = 0; i < incident_size[vertex]; i++) grown[i] = incident[vertex][i];
+        delete[] incident[vertex];
+        incident[vertex] = grown;
+        incident_capacity[vertex] = new_capacity;
+    }
+    position = incident_size[vertex];
+    incident[vertex][incident_size[vertex]++] = e;
+}
+
+// Wymiana z ostatnim elementem i poprawienie zapamietanej pozycji przeniesionej krawedzi
+void DynamicMST::removeIncident(int vertex, int position) {
+    int last = incident[vertex][--incident_size[vertex]];
+    incident[vertex][position] = last;
+    if(edges[last].start == vertex) edges[last].pos_start = position;
+    else edges[last].pos_end = position;
+}
+
+int DynamicMST::allocateEdge(int start, int end, int weight) {
+    int e;
+    if(free_count > 0) {
+        e = free_slots[--free_count];
+    } else {
+        if(slot_count == capacity) {
+            int new_capacity = capacity * 2;
+            DynamicEdge* grown = new DynamicEdge[new_capacity];
+            for(int i = 0; i < slot_count; i++) grown[i] = edges[i];
+            delete[] edges;
+            delete[] free_slots;
+            edges = grown;
+            free_slots = new int[new_capacity];
+            capacity = new_capacity;
+            forest.resize(vertices + capacity);
+        }
+        e = slot_count++;
+    }
+    
+    DynamicEdge& edge = edges[e];
+    edge.start = start;
+    edge.end = end;
+    edge.weight = weight;
+    edge.alive = true;
+    edge.in_tree = false;
+    addIncident(start, e, edge.pos_start);
+    addIncident(end, e, edge.pos_end);
+    forest.setValue(vertices + e, weight);
+    return e;
+}
+
+void DynamicMST::releaseEdge(int e) {
+    removeIncident(edges[e].start, edges[e].pos_start);
+    removeIncident(edges[e].end, edges[e].pos_end);
+    edges[e].alive = false;
+    free_slots[free_count++] = e;
+}
+
+// Przeszukanie krotszej z list incydencji koncow
+int DynamicMST::findEdge(int start, int end) const {
+    if(start < 0 || end < 0 || start >= vertices || end >= vertices) return -1;
+    int from = incident_size[start] <= incident_size[end] ? start : end;
+    int to = from == start ? end : start;
+    for(int i = 0; i < incident_size[from]; i++) {
+        int e = incident[from][i];
+        if(edges[e].start == to || edges[e].end == to) return e;
+    }
+    return -1;
+}
+
+void DynamicMST::linkEdge(int e) {
+    forest.link(edges[e].start, vertices + e);
+    forest.link(vertices + e, edges[e].end);
+    edges[e].in_tree = true;
+    total_weight += edges[e].weight;
+    tree_edges++;
+}
+
+void DynamicMST::cutEdge(int e) {
+    forest.cut(edges[e].start, vertices + e);
+    forest.cut(vertices + e, edges[e].end);
+    edges[e].in_tree = false;
+    total_weight -= edges[e].weight;
+    tree_edges--;
+}
+
+// Krawedz spoza lasu: laczy dwa drzewa albo zastepuje najciezsza krawedz cyklu
+void DynamicMST::reconnect(int e) {
+    int start = edges[e].start, end = edges[e].end;
+    if(!forest.connected(start, end)) {
+        linkEdge(e);
+        return;
+    }
+    int heaviest = forest.pathMax(start, end);
+    if(heaviest >= vertices && forest.getValue(heaviest) > edges[e].weight) {
+        cutEdge(heaviest - vertices);
+        linkEdge(e);
+    }
+}
+
+// Po przecieciu krawedzi drzewa miedzy a i b: BFS po drzewie naprzemiennie z obu
+// stron konczy sie na mniejszej czesci, a krawedz zastepcza to najlzejsza krawedz
+// spoza lasu wychodzaca z tej czesci. Zwraca -1, gdy czesci nie da sie polaczyc.
+int DynamicMST::findReplacement(int a, int b) {
+    mark_stamp += 2;
+    int mark_a = mark_stamp, mark_b = mark_stamp + 1;
+    int head_a = 0, tail_a = 0, head_b = 0, tail_b = 0;
+    queue_first[tail_a++] = a;
+    queue_second[tail_b++] = b;
+    mark[a] = mark_a;
+    mark[b] = mark_b;
+    
+    int* side = nullptr;
+    int side_size = 0, side_mark = 0;
+    while(!side) {
+        if(head_a == tail_a) {
+            side = queue_first;
+            side_size = tail_a;
+            side_mark = mark_a;
+            break;
+        }
+        int x = queue_first[head_a++];
+        for(int i = 0; i < incident_size[x]; i++) {
+            const DynamicEdge& edge = edges[incident[x][i]];
+            if(!edge.in_tree) continue;
+            int y = edge.start == x ? edge.end : edge.start;
+            if(mark[y] != mark_a) {
+                mark[y] = mark_a;
+                queue_first[tail_a++] = y;
+            }
+        }
+        
+        if(head_b == tail_b) {
+            side = queue_second;
+            side_size = tail_b;
+            side_mark = mark_b;
+            break;
+        }
+        x = queue_second[head_b++];
+        for(int i = 0; i < incident_size[x]; i++) {
+            const DynamicEdge& edge = edges[incident[x][i]];
+            if(!edge.in_tree) continue;
+            int y = edge.start == x ? edge.end : edge.start;
+            if(mark[y] != mark_b) {
+                mark[y] = mark_b;
+                queue_second[tail_b++] = y;
+            }
+        }
+    }
+    
+    // Krawedzie spoza lasu lacza wierzcholki jednej skladowej, wiec kazda wychodzaca
+    // z mniejszej czesci prowadzi do drugiej
+    int best = -1;
+    for(int i = 0; i < side_size; i++) {
+        int x = side[i];
+        for(int j = 0; j < incident_size[x]; j++) {
+            int e = incident[x][j];
+            const DynamicEdge& edge = edges[e];
+            if(edge.in_tree) continue;
+            int y = edge.start == x ? edge.end : edge.start;
+            if(mark[y] != side_mark && (best < 0 || edge.weight < edges[best].weight)) best = e;
+        }
+    }
+    return best;
+}
+
+bool DynamicMST::insertEdge(int start, int end, int weight) {
+    if(start < 0 || end < 0 || start >= vertices || end >= vertices || start == end) return false;
+    if(findEdge(start, end) >= 0) return false;
+    reconnect(allocateEdge(start, end, weight));
+    return true;
+}
+
+bool DynamicMST::removeEdge(int start, int end) {
+    int e = findEdge(start, end);
+    if(e < 0) return false;
+    
+    bool was_tree = edges[e].in_tree;
+    if(was_tree) cutEdge(e);
+    releaseEdge(e);
+    if(was_tree) {
+        int replacement = findReplacement(start, end);
+        if(replacement >= 0) linkEdge(replacement);
+    }
+    return true;
+}
+
+bool DynamicMST::setEdgeWeight(int start, int end, int weight) {
+    int e = findEdge(start, end);
+    if(e < 0) return false;
+    
+    DynamicEdge& edge = edges[e];
+    int old_weight = edge.weight;
+    if(edge.in_tree && weight <= old_weight) {
+        // Lzejsza krawedz drzewa pozostaje w drzewie
+        forest.setValue(vertices + e, weight);
+        total_weight += weight - old_weight;
+        edge.weight = weight;
+    } else if(edge.in_tree) {
+        // Ciezsza krawedz drzewa: najlzejsza krawedz przez przeciecie (moze to byc ona sama)
+        cutEdge(e);
+        edge.weight = weight;
+        forest.setValue(vertices + e, weight);
+        linkEdge(findReplacement(start, end));
+    } else {
+        edge.weight = weight;
+        forest.setValue(vertices + e, weight);
+        if(weight < old_weight) reconnect(e);
+    }
+    return true;
+}
+
+int DynamicMST::collectTree(Edge* result) const {
+    int count = 0;
+    for(int e = 0; e < slot_count; e++) {
+        if(edges[e].alive && edges[e].in_tree) result[count++] = Edge(edges[e].start, edges[e].end, edges[e].weight);
+    }
+    return count;
+}
+
+// ---------------------------------------------------------------------------
+// Menu i test opoznien
+
+enum MSTUpdate {
+    UPDATE_INSERT = 0,
+    UPDATE_REMOVE = 1,
+    UPDATE_REWEIGHT = 2,
+    UPDATE_COUNT
+};
+
+static double elapsedSeconds(std::chrono::high_resolution_clock::time_point start_time) {
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now() - start_time);
+    return duration.count() / 1000000000.0;
+}
+
+// Losowa zmiana zastosowana do struktury (mierzona) i do grafu; false - nie udalo sie jej wylosowac
+static bool randomUpdate(Graph& graph, DynamicMST& mst, int type, double& seconds) {
+    int vertices = graph.getVertices();
+    int weight = rand() % 100 + 1;
+    
+    if(type == UPDATE_INSERT) {
+        for(int attempt = 0; attempt < 100; attempt++) {
+            int start = rand() % vertices, end = rand() % vertices;
+            if(start == end || graph.getEdgeWeight(start, end) != 0) continue;
+            auto start_time = std::chrono::high_resolution_clock::now();
+            mst.insertEdge(start, end, weight);
+            seconds = elapsedSeconds(start_time);
+            graph.insertEdge(start, end, weight);
+            return true;
+        }
+        return false;
+    }
+    
+    if(graph.getEdgeCount() == 0) return false;
+    Edge edge = graph.getListEntry(rand() % graph.getListEntryCount());
+    auto start_time = std::chrono::high_resolution_clock::now();
+    if(type == UPDATE_REMOVE) mst.removeEdge(edge.start, edge.end);
+    else mst.setEdgeWeight(edge.start, edge.end, weight);
+    seconds = elapsedSeconds(start_time);
+    if(type == UPDATE_REMOVE) graph.removeEdge(edge.start, edge.end);
+    else graph.setEdgeWeight(edge.start, edge.end, weight);
+    return true;
+}
+
+// Opoznienie aktualizacji struktury dynamicznej wobec pelnego przeliczenia algorytmem
+// seed (reprezentacja listowa) po kazdej zmianie; przeliczenie co step zmian, aby
+// test konczyl sie w rozsadnym czasie, z porownaniem wag drzew o tej samej liczbie krawedzi
+static void updateLatencyBenchmark(Graph& graph, DynamicMST& mst, const AlgorithmInfo& seed) {
+    static const char* update_names[] = {"wstawienie", "usuniecie", "zmiana wagi"};
+    int updates;
+    std::cout << "Liczba losowych zmian: ";
+    std::cin >> updates;
+    if(updates <= 0) return;
+    int step = updates / 50 > 0 ? updates / 50 : 1;
+    
+    double total[UPDATE_COUNT] = {0.0};
+    int count[UPDATE_COUNT] = {0};
+    double recompute_total = 0.0;
+    int recomputations = 0;
+    int mismatches = 0;
+    int disconnected = 0;
+    Edge* tree = new Edge[graph.getVertices()];
+    
+    for(int i = 0; i < updates; i++) {
+        int type = rand() % UPDATE_COUNT;
+        double seconds = 0.0;
+        if(!randomUpdate(graph, mst, type, seconds)) continue;
+        total[type] += seconds;
+        count[type]++;
+        
+        if((i + 1) % step == 0) {
+            AlgorithmOutput output;
+            output.tree = tree;
+            recompute_total += seed.execute(graph, REP_LIST, &output);
+            recomputations++;
+            // Prim w grafie niespojnym rozpina tylko skladowa startu - wag nie da sie porownac
+            if(output.tree_size != mst.getTreeEdgeCount()) disconnected++;
+            else if(output.weight != mst.getWeight()) mismatches++;
+        }
+    }
+    
+    double dynamic_total = 0.0;
+    int dynamic_count = 0;
+    std::cout << "\nOpoznienie aktualizacji (srednio na zmiane):" << std::endl;
+    for(int type = 0; type < UPDATE_COUNT; type++) {
+        if(count[type] == 0) continue;
+        std::cout << "  " << std::left << std::setw(12) << update_names[type] << std::right << " = " << std::fixed
+                  << std::setprecision(3) << total[type] / count[type] * 1000000.0 << " us (" << count[type] << " zmian)" << std::endl;
+        dynamic_total += total[type];
+        dynamic_count += count[type];
+    }
+    delete[] tree;
+    if(dynamic_count == 0 || recomputations == 0) return;
+    
+    double dynamic_average = dynamic_total / dynamic_count;
+    double recompute_average = recompute_total / recomputations;
+    std::cout << "  struktura dynamiczna = " << dynamic_average * 1000000.0 << " us" << std::endl;
+    std::cout << "  pelne przeliczenie (" << seed.name << ", listowa) = " << recompute_average * 1000000.0
+              << " us (" << recomputations << " pomiarow)" << std::endl;
+    if(dynamic_average > 0.0) {
+        std::cout << "  przyspieszenie = " << std::setprecision(1) << recompute_average / dynamic_average << "x" << std::endl;
+    }
+    std::cout << "  zgodnosc wag drzew: " << (mismatches == 0 ? "OK" : "NIEZGODNOSCI = " + std::to_string(mismatches)) << std::endl;
+    if(disconnected > 0) {
+        std::cout << "  pominiete porownania (graf niespojny, " << seed.name << " rozpina jedna skladowa): " << disconnected << std::endl;
+    }
+}
+
+void dynamicMSTMenu(Graph& graph, const AlgorithmInfo& seed) {
+    if(graph.isDirected()) {
+        std::cout << "Dynamiczne MST wymaga grafu nieskierowanego!" << std::endl;
+        return;
+    }
+    
+    // Drzewo startowe z algorytmu, z ktorego menu wywolano opcje
+    int vertices = graph.getVertices();
+    Edge* tree = new Edge[vertices > 0 ? vertices : 1];
+    AlgorithmOutput output;
+    output.tree = tree;
+    double seed_seconds = seed.execute(graph, REP_LIST, &output);
+    auto start_time = std::chrono::high_resolution_clock::now();
+    DynamicMST mst(graph, tree, output.tree_size);
+    double build_seconds = elapsedSeconds(start_time);
+    std::cout << "Drzewo startowe (" << seed.name << "): waga = " << mst.getWeight() << ", czas = " << std::fixed
+              << std::setprecision(6) << seed_seconds << " s, budowa struktury = " << build_seconds << " s" << std::endl;
+    
+    const int* current_id = graph.getCurrentId();
+    int option;
+    do {
+        std::cout << "\nDynamiczne MST:" << std::endl;
+        std::cout << "1. Wstaw krawedz" << std::endl;
+        std::cout << "2. Usun krawedz" << std::endl;
+        std::cout << "3. Zmien wage krawedzi" << std::endl;
+        std::cout << "4. Wyswietl drzewo" << std::endl;
+        std::cout << "5. Opoznienie aktualizacji a pelne przeliczenie (losowe zmiany)" << std::endl;
+        std::cout << "0. Powrot" << std::endl;
+        std::cout << "Wybierz opcje: ";
+        std::cin >> option;
+        
+        if(option >= 1 && option <= 3) {
+            int start, end, weight = 0;
+            std::cout << "Podaj wierzcholki krawedzi: ";
+            std::cin >> start >> end;
+            if(option != 2) {
+                std::cout << "Podaj wage: ";
+                std::cin >> weight;
+            }
+            if(start < 0 || end < 0 || start >= vertices || end >= vertices) {
+                std::cout << "Nieprawidlowy wierzcholek!" << std::endl;
+                continue;
+            }
+            start = current_id[start];
+            end = current_id[end];
+            
+            // Graf sprawdza poprawnosc zmiany, struktura dynamiczna ja powtarza
+            bool applied = false;
+            auto update_time = std::chrono::high_resolution_clock::now();
+            if(option == 1 && graph.insertEdge(start, end, weight)) applied = mst.insertEdge(start, end, weight);
+            if(option == 2 && graph.removeEdge(start, end)) applied = mst.removeEdge(start, end);
+            if(option == 3 && graph.setEdgeWeight(start, end, weight)) applied = mst.setEdgeWeight(start, end, weight);
+            double seconds = elapsedSeconds(update_time);
+            if(!applied) {
+                std::cout << "Nie mozna wykonac zmiany (krawedz istnieje / nie istnieje lub waga 0)." << std::endl;
+                continue;
+            }
+            std::cout << "Waga drzewa = " << mst.getWeight() << " (" << mst.getTreeEdgeCount() << " krawedzi), czas zmiany = "
+                      << std::setprecision(6) << seconds << " s" << std::endl;
+        } else if(option == 4) {
+            int count = mst.collectTree(tree);
+            printSpanningTree(graph, tree, count);
+        } else if(option == 5) {
+            updateLatencyBenchmark(graph, mst, seed);
+        } else if(option != 0) {
+            std::cout << "Nieprawidlowa opcja!" << std::endl;
+        }
+    } while(option != 0);
+    
+    delete[] tree;
+}
@@ -0,0 +1,103 @@
+#ifndef DYNAMICMST_H
+#define DYNAMICMST_H
+
+#include "Algorithms.h"
+
+// Drzewo link-cut (Sleator-Tarjan) z maksimum na sciezce. Wezly 0..n-1; krawedzie
+// lasu sa osobnymi wezlami z waga, wierzcholki maja wage INT_MIN, wiec pathMax
+// zwraca wezel najciezszej krawedzi sciezki. Drzewa pomocnicze to drzewa splay.
+class LinkCutTree {
+private:
+    int nodes;
+    int* left;
+    int* right;
+    int* parent;
+    int* value;
+    int* max_node; // wezel o najwiekszej wartosci w poddrzewie splay
+    bool* reversed;
+    int* stack;
+    
+    bool isRoot(int x) const;
+    void update(int x);
+    void pushDown(int x);
+    void rotate(int x);
+    void splay(int x);
+    void access(int x);
+    void makeRoot(int x);
+    int findRoot(int x);
+    
+public:
+    LinkCutTree(int n);
+    ~LinkCutTree();
+    
+    // Powiekszenie do n wezlow (nowe wezly sa osobnymi drzewami)
+    void resize(int n);
+    void setValue(int x, int weight);
+    int getValue(int x) const { return value[x]; }
+    void link(int x, int y);
+    void cut(int x, int y);
+    bool connected(int x, int y);
+    int pathMax(int x, int y);
+};
+
+// Krawedz struktury dynamicznej; pos_start/pos_end - pozycje na listach incydencji koncow
+struct DynamicEdge {
+    int start, end, weight;
+    bool alive;
+    bool in_tree;
+    int pos_start, pos_end;
+};
+
+// Minimalny las rozpinajacy utrzymywany przy wstawianiu, usuwaniu i zmianie wag krawedzi
+// grafu nieskierowanego, zainicjowany drzewem z Prima lub Kruskala.
+// - wstawienie / zmniejszenie wagi: zamiana z najciezsza krawedzia cyklu (pathMax), O(log V)
+// - usuniecie / zwiekszenie wagi krawedzi drzewa: przeciecie i szukanie krawedzi zastepczej
+//   wsrod krawedzi incydentnych z mniejsza czescia (rownolegly BFS po drzewie z obu koncow)
+class DynamicMST {
+private:
+    int vertices;
+    int capacity;
+    int slot_count;     // wykorzystane miejsca tablicy edges
+    DynamicEdge* edges; // wezel lasu krawedzi e to vertices + e
+    int* free_slots;
+    int free_count;
+    int** incident;
+    int* incident_size;
+    int* incident_capacity;
+    LinkCutTree forest;
+    long long total_weight;
+    int tree_edges;
+    
+    int* mark;
+    int mark_stamp;
+    int* queue_first;
+    int* queue_second;
+    
+    int allocateEdge(int start, int end, int weight);
+    void releaseEdge(int e);
+    void addIncident(int vertex, int e, int& position);
+    void removeIncident(int vertex, int position);
+    int findEdge(int start, int end) const;
+    void linkEdge(int e);
+    void cutEdge(int e);
+    int findReplacement(int a, int b);
+    void reconnect(int e);
+    
+public:
+    DynamicMST(Graph& graph, const Edge* tree, int tree_count);
+    ~DynamicMST();
+    
+    bool insertEdge(int start, int end, int weight);
+    bool removeEdge(int start, int end);
+    bool setEdgeWeight(int start, int end, int weight);
+    
+    long long getWeight() const { return total_weight; }
+    int getTreeEdgeCount() const { return tree_edges; }
+    int collectTree(Edge* result) const;
+};
+
+// Opcje dodatkowe algorytmow MST: zmiany krawedzi z utrzymywaniem drzewa oraz
+// porownanie opoznienia aktualizacji z pelnym przeliczeniem algorytmem seed
+void dynamicMSTMenu(Graph& graph, const AlgorithmInfo& seed);
+
+#endif
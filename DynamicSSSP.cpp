@@ -0,0 +1,437 @@
+#include "DynamicSSSP.h"
+#include "MinHeap.h"
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <climits>
+#include <cstdlib>
+
+DynamicShortestPaths::DynamicShortestPaths(Graph& g, bool allow_negative)
+    : graph(g), vertices(g.getVertices()), start_vertex(g.getStartVertex()), label_correcting(allow_negative),
+      valid(false), pending_count(0), pending_capacity(16), affected_stamp(0), queue_head(0), queue_size(0),
+      touched_count(0), cycle_found(false), last_touched(0) {
+    dist = new int[vertices];
+    parent = new int[vertices];
+    first_child = new int[vertices];
+    next_sibling = new int[vertices];
+    previous_sibling = new int[vertices];
+    pending = new ArcUpdate[pending_capacity];
+    affected = new int[vertices];
+    stack = new int[vertices];
+    heap = new MinHeap(vertices);
+    queue = new int[vertices];
+    in_queue = new bool[vertices];
+    enqueued = new int[vertices];
+    touched = new int[vertices];
+    for(int v = 0; v < vertices; v++) {
+        dist[v] = INT_MAX;
+        parent[v] = first_child[v] = next_sibling[v] = previous_sibling[v] = -1;
+        affected[v] = 0;
+        in_queue[v] = false;
+        enqueued[v] = 0;
+    }
+}
+
+DynamicShortestPaths::~DynamicShortestPaths() {
+    delete[] dist;
+    delete[] parent;
+    delete[] first_child;
+    delete[] next_sibling;
+    delete[] previous_sibling;
+    delete[] pending;
+    delete[] affected;
+    delete[] stack;
+    delete heap;
+    delete[] queue;
+    delete[] in_queue;
+    delete[] enqueued;
+    delete[] touched;
+}
+
+void DynamicShortestPaths::reset(const int* initial_dist, const int* initial_parent, bool negative_cycle) {
+    start_vertex = graph.getStartVertex();
+    pending_count = 0;
+    valid = !negative_cycle;
+    // Mapa bitowa (V*V/8 bajtow, aktualizowana przez zmiany krawedzi) dla przegladania
+    // poprzednikow w seedAffected - budowana tutaj, poza mierzona naprawa
+    graph.buildAdjacencyBitmap();
+    for(int v = 0; v < vertices; v++) {
+        dist[v] = initial_dist[v];
+        parent[v] = -1;
+        first_child[v] = next_sibling[v] = previous_sibling[v] = -1;
+    }
+    // Przy cyklu ujemnym poprzednicy moga tworzyc cykl - drzewo nie jest budowane
+    if(!valid) return;
+    for(int v = 0; v < vertices; v++) {
+        if(initial_parent[v] >= 0) setParent(v, initial_parent[v]);
+    }
+}
+
+void DynamicShortestPaths::detach(int vertex) {
+    if(parent[vertex] < 0) return;
+    if(previous_sibling[vertex] >= 0) next_sibling[previous_sibling[vertex]] = next_sibling[vertex];
+    else first_child[parent[vertex]] = next_sibling[vertex];
+    if(next_sibling[vertex] >= 0) previous_sibling[next_sibling[vertex]] = previous_sibling[vertex];
+    parent[vertex] = -1;
+}
+
+void DynamicShortestPaths::setParent(int vertex, int new_parent) {
+    detach(vertex);
+    parent[vertex] = new_parent;
+    previous_sibling[vertex] = -1;
+    next_sibling[vertex] = first_child[new_parent];
+    if(first_child[new_parent] >= 0) previous_sibling[first_child[new_parent]] = vertex;
+    first_child[new_parent] = vertex;
+}
+
+bool DynamicShortestPaths::update(int start, int end, int weight) {
+    if(start < 0 || end < 0 || start >= vertices || end >= vertices || start == end) return false;
+    if(weight < 0 && !label_correcting) return false;
+    // Odleglosci sa typu int - waga, z ktora sciezka prosta moglaby przekroczyc zakres, jest odrzucana
+    if(!graph.distancesFitIntWith(weight)) return false;
+    
+    int old_weight = graph.getEdgeWeight(start, end);
+    if(old_weight == weight) return false;
+    bool applied;
+    if(old_weight == 0) applied = graph.insertEdge(start, end, weight);
+    else if(weight == 0) applied = graph.removeEdge(start, end);
+    else applied = graph.setEdgeWeight(start, end, weight);
+    if(!applied) return false;
+    if(!valid) return true;
+    
+    if(pending_count == pending_capacity) {
+        int new_capacity = pending_capacity * 2;
+        ArcUpdate* grown = new ArcUpdate[new_capacity];
+        for(int i = 0; i < pending_count; i++) grown[i] = pending[i];
+        delete[] pending;
+        pending = grown;
+        pending_capacity = new_capacity;
+    }
+    ArcUpdate& arc = pending[pending_count++];
+    arc.start = start;
+    arc.end = end;
+    arc.old_weight = old_weight;
+    arc.new_weight = weight;
+    return true;
+}
+
+// Poddrzewo drzewa sciezek zaczepione w root dopisywane do stack[count..]
+int DynamicShortestPaths::collectAffected(int root, int count) {
+    if(affected[root] == affected_stamp) return count;
+    affected[root] = affected_stamp;
+    int first = count;
+    stack[count++] = root;
+    for(int i = first; i < count; i++) {
+        for(int child = first_child[stack[i]]; child >= 0; child = next_sibling[child]) {
+            if(affected[child] == affected_stamp) continue;
+            affected[child] = affected_stamp;
+            stack[count++] = child;
+        }
+    }
+    return count;
+}
+
+// Odleglosci wierzcholkow poddrzew od poprzednikow spoza nich: kolumna mapy bitowej dla
+// kazdego wierzcholka (O(V) bitow na wierzcholek, waga tylko dla istniejacych lukow) albo
+// jedno przejscie po wszystkich listach, gdy poddrzewa sa duze. Macierz V*V nie jest budowana.
+void DynamicShortestPaths::seedAffected(int count) {
+    if((long long)count * vertices <= graph.getEdgeCount()) {
+        const AdjacencyBitmap& bits = graph.getAdjacencyBitmap();
+        for(int i = 0; i < count; i++) {
+            int v = stack[i];
+            for(int x = 0; x < vertices; x++) {
+                if(bits.test(x, v)) relax(x, v, graph.getEdgeWeight(x, v));
+            }
+        }
+        return;
+    }
+    
+    int** adjacency_list = graph.getList();
+    int* list_sizes = graph.getListSizes();
+    for(int x = 0; x < vertices; x++) {
+        if(dist[x] == INT_MAX) continue;
+        for(int j = 0; j < list_sizes[x]; j++) {
+            int v = adjacency_list[x][j * 2];
+            if(affected[v] == affected_stamp) relax(x, v, adjacency_list[x][j * 2 + 1]);
+        }
+    }
+}
+
+// Suma w long long: sciezki proste mieszcza sie w int (update pilnuje distancesFitInt), wiec
+// etykieta ponizej INT_MIN to spacer przez cykl ujemny i konczy propagacje jak licznik kolejki
+void DynamicShortestPaths::relax(int from, int to, int weight) {
+    if(dist[from] == INT_MAX) return;
+    long long candidate = (long long)dist[from] + weight;
+    if(candidate >= dist[to]) return;
+    if(candidate < INT_MIN) {
+        cycle_found = true;
+        return;
+    }
+    dist[to] = (int)candidate;
+    setParent(to, from);
+    push(to);
+}
+
+void DynamicShortestPaths::push(int vertex) {
+    if(!label_correcting) {
+        if(heap->isInHeap(vertex)) heap->decreaseKey(vertex, dist[vertex]);
+        else heap->insert(vertex, dist[vertex]);
+        return;
+    }
+    
+    if(in_queue[vertex]) return;
+    // Wierzcholek wstawiany V razy lezy na cyklu ujemnym (lub jest z niego osiagalny)
+    if(enqueued[vertex] == 0) touched[touched_count++] = vertex;
+    if(++enqueued[vertex] >= vertices) {
+        cycle_found = true;
+        return;
+    }
+    in_queue[vertex] = true;
+    queue[(queue_head + queue_size++) % vertices] = vertex;
+}
+
+bool DynamicShortestPaths::propagate() {
+    int** adjacency_list = graph.getList();
+    int* list_sizes = graph.getListSizes();
+    
+    if(!label_correcting) {
+        // Wagi nieujemne: etykiety spoza kopca sa spojne, wiec zdejmowane minimum jest ostateczne
+        while(!heap->isEmpty()) {
+            int u = heap->extractMin().vertex;
+            last_touched++;
+            for(int j = 0; j < list_sizes[u]; j++) relax(u, adjacency_list[u][j * 2], adjacency_list[u][j * 2 + 1]);
+        }
+        return true;
+    }
+    
+    while(queue_size > 0 && !cycle_found) {
+        int u = queue[queue_head];
+        queue_head = (queue_head + 1) % vertices;
+        queue_size--;
+        in_queue[u] = false;
+        last_touched++;
+        for(int j = 0; j < list_sizes[u] && !cycle_found; j++) relax(u, adjacency_list[u][j * 2], adjacency_list[u][j * 2 + 1]);
+    }
+    
+    while(queue_size > 0) {
+        in_queue[queue[queue_head]] = false;
+        queue_head = (queue_head + 1) % vertices;
+        queue_size--;
+    }
+    for(int i = 0; i < touched_count; i++) enqueued[touched[i]] = 0;
+    touched_count = 0;
+    queue_head = 0;
+    
+    if(cycle_found) {
+        cycle_found = false;
+        valid = false;
+        return false;
+    }
+    return true;
+}
+
+bool DynamicShortestPaths::repair() {
+    last_touched = 0;
+    if(!valid) {
+        pending_count = 0;
+        return false;
+    }
+    
+    // Zwiekszenia i usuniecia lukow drzewa: poddrzewa ich koncow do odtworzenia
+    affected_stamp++;
+    int affected_count = 0;
+    for(int i = 0; i < pending_count; i++) {
+        const ArcUpdate& arc = pending[i];
+        bool increased = arc.new_weight == 0 || arc.new_weight > arc.old_weight;
+        if(increased && parent[arc.end] == arc.start) affected_count = collectAffected(arc.end, affected_count);
+    }
+    for(int i = 0; i < affected_count; i++) {
+        dist[stack[i]] = INT_MAX;
+        detach(stack[i]);
+    }
+    seedAffected(affected_count);
+    
+    // Zmniejszenia i wstawienia: relaksacja luku z aktualna waga
+    for(int i = 0; i < pending_count; i++) {
+        const ArcUpdate& arc = pending[i];
+        int weight = graph.getEdgeWeight(arc.start, arc.end);
+        bool decreased = arc.new_weight != 0 && (arc.old_weight == 0 || arc.new_weight < arc.old_weight);
+        if(decreased && weight != 0) relax(arc.start, arc.end, weight);
+    }
+    pending_count = 0;
+    
+    return propagate();
+}
+
+// ---------------------------------------------------------------------------
+// Menu i test partii zmian
+
+static double elapsedSeconds(std::chrono::high_resolution_clock::time_point start_time) {
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now() - start_time);
+    return duration.count() / 1000000000.0;
+}
+
+// Pelne przeliczenie algorytmem seed i stan poczatkowy struktury z jego wyniku
+static double recompute(Graph& graph, DynamicShortestPaths& paths, const AlgorithmInfo& seed, AlgorithmOutput& output) {
+    double seconds = seed.execute(graph, REP_LIST, &output);
+    paths.reset(output.dist, output.parent, output.negative_cycle);
+    return seconds;
+}
+
+// Losowa zmiana: wstawienie (wagi 1..100), zmniejszenie, zwiekszenie albo usuniecie luku.
+// Zmniejszenia schodza ponizej zera tylko przy wagach ujemnych (Bellman-Ford).
+static bool randomArcUpdate(Graph& graph, DynamicShortestPaths& paths, bool allow_negative) {
+    int vertices = graph.getVertices();
+    int type = rand() % 4;
+    
+    if(type == 0 || graph.getEdgeCount() == 0) {
+        for(int attempt = 0; attempt < 100; attempt++) {
+            int start = rand() % vertices, end = rand() % vertices;
+            if(start == end || graph.getEdgeWeight(start, end) != 0) continue;
+            return paths.update(start, end, rand() % 100 + 1);
+        }
+        return false;
+    }
+    
+    Edge edge = graph.getListEntry(rand() % graph.getListEntryCount());
+    int weight = edge.weight;
+    if(type == 1) {
+        weight -= rand() % 20 + 1;
+        if(!allow_negative && weight < 1) weight = 1;
+        if(weight == 0) weight = -1;
+    } else if(type == 2) {
+        weight += rand() % 20 + 1;
+        if(weight == 0) weight = 1;
+    } else {
+        weight = 0;
+    }
+    return paths.update(edge.start, edge.end, weight);
+}
+
+// Partie losowych zmian: czas naprawy wobec pelnego przeliczenia algorytmem seed
+// (reprezentacja listowa) po kazdej partii, z porownaniem odleglosci
+static void batchRepairBenchmark(Graph& graph, DynamicShortestPaths& paths, const AlgorithmInfo& seed, bool allow_negative) {
+    int batches, batch_size;
+    std::cout << "Liczba partii: ";
+    std::cin >> batches;
+    std::cout << "Liczba zmian w partii: ";
+    std::cin >> batch_size;
+    if(batches <= 0 || batch_size <= 0) return;
+    
+    int vertices = graph.getVertices();
+    AlgorithmOutput full;
+    full.dist = new int[vertices];
+    full.parent = new int[vertices];
+    double repair_total = 0.0, recompute_total = 0.0;
+    long long touched_total = 0;
+    int repairs = 0, fallbacks = 0, mismatches = 0;
+    
+    for(int batch = 0; batch < batches; batch++) {
+        for(int i = 0; i < batch_size; i++) randomArcUpdate(graph, paths, allow_negative);
+        
+        bool was_valid = paths.isValid();
+        bool repaired = false;
+        if(was_valid) {
+            auto start_time = std::chrono::high_resolution_clock::now();
+            repaired = paths.repair();
+            repair_total += elapsedSeconds(start_time);
+            touched_total += paths.getLastTouched();
+            repairs++;
+        }
+        
+        recompute_total += seed.execute(graph, REP_LIST, &full);
+        if(repaired) {
+            bool same = !full.negative_cycle;
+            for(int v = 0; v < vertices && same; v++) same = paths.getDist()[v] == full.dist[v];
+            if(!same) mismatches++;
+        } else {
+            // Cykl ujemny (wykryty teraz lub wczesniej): stan z pelnego przeliczenia
+            if(was_valid && !full.negative_cycle) mismatches++;
+            fallbacks++;
+            paths.reset(full.dist, full.parent, full.negative_cycle);
+        }
+    }
+    
+    std::cout << "\nNaprawa po partii " << batch_size << " zmian:" << std::endl;
+    if(repairs > 0) {
+        double repair_average = repair_total / repairs;
+        double recompute_average = recompute_total / batches;
+        std::cout << "  naprawa = " << std::fixed << std::setprecision(3) << repair_average * 1000000.0 << " us, srednio "
+                  << std::setprecision(1) << (double)touched_total / repairs << " wierzcholkow przetworzonych" << std::endl;
+        std::cout << "  pelne przeliczenie (" << seed.name << ", listowa) = " << std::setprecision(3)
+                  << recompute_average * 1000000.0 << " us" << std::endl;
+        if(repair_average > 0.0) {
+            std::cout << "  przyspieszenie = " << std::setprecision(1) << recompute_average / repair_average << "x" << std::endl;
+        }
+    }
+    if(fallbacks > 0) std::cout << "  pelne przeliczenia po cyklu ujemnym: " << fallbacks << std::endl;
+    std::cout << "  zgodnosc odleglosci: " << (mismatches == 0 ? "OK" : "NIEZGODNOSCI = " + std::to_string(mismatches)) << std::endl;
+    
+    delete[] full.dist;
+    delete[] full.parent;
+}
+
+void dynamicShortestPathsMenu(Graph& graph, const AlgorithmInfo& seed, bool allow_negative) {
+    int vertices = graph.getVertices();
+    AlgorithmOutput output;
+    output.dist = new int[vertices];
+    output.parent = new int[vertices];
+    DynamicShortestPaths paths(graph, allow_negative);
+    double seed_seconds = recompute(graph, paths, seed, output);
+    std::cout << "Stan poczatkowy (" << seed.name << "): czas = " << std::fixed << std::setprecision(6) << seed_seconds << " s";
+    if(!paths.isValid()) std::cout << " - CYKL UJEMNY, zmiany beda wymagaly pelnego przeliczenia";
+    std::cout << std::endl;
+    
+    const int* current_id = graph.getCurrentId();
+    int option;
+    do {
+        std::cout << "\nNaprawa najkrotszych sciezek (zmian w partii: " << paths.getPendingCount() << "):" << std::endl;
+        std::cout << "1. Zmien luk (wstawienie, nowa waga, 0 - usuniecie)" << std::endl;
+        std::cout << "2. Napraw sciezki po partii zmian" << std::endl;
+        std::cout << "3. Wyswietl najkrotsze sciezki" << std::endl;
+        std::cout << "4. Naprawa a pelne przeliczenie (losowe partie zmian)" << std::endl;
+        std::cout << "0. Powrot" << std::endl;
+        std::cout << "Wybierz opcje: ";
+        std::cin >> option;
+        
+        if(option == 1) {
+            int start, end, weight;
+            std::cout << "Podaj poczatek i koniec luku: ";
+            std::cin >> start >> end;
+            std::cout << "Podaj wage (0 - usuniecie): ";
+            std::cin >> weight;
+            if(start < 0 || end < 0 || start >= vertices || end >= vertices) {
+                std::cout << "Nieprawidlowy wierzcholek!" << std::endl;
+            } else if(!paths.update(current_id[start], current_id[end], weight)) {
+                std::cout << "Nie mozna wykonac zmiany (brak zmiany wagi, waga ujemna dla " << seed.name
+                          << " lub waga, z ktora odleglosci moga przekroczyc zakres int)." << std::endl;
+            }
+        } else if(option == 2 || option == 3) {
+            if(paths.isValid() && (option == 2 || paths.getPendingCount() > 0)) {
+                auto start_time = std::chrono::high_resolution_clock::now();
+                bool repaired = paths.repair();
+                double seconds = elapsedSeconds(start_time);
+                if(repaired) {
+                    std::cout << "Naprawa: " << paths.getLastTouched() << " wierzcholkow przetworzonych, czas = "
+                              << std::setprecision(6) << seconds << " s" << std::endl;
+                }
+            }
+            if(!paths.isValid()) {
+                double seconds = recompute(graph, paths, seed, output);
+                std::cout << "Cykl ujemny - pelne przeliczenie (" << std::setprecision(6) << seconds << " s)"
+                          << (paths.isValid() ? "" : ": CYKL UJEMNY NADAL W GRAFIE") << std::endl;
+            }
+            if(option == 3) {
+                if(paths.isValid()) printShortestPaths(graph, paths.getDist(), paths.getParent());
+                else std::cout << "WYKRYTO CYKL UJEMNY W GRAFIE!" << std::endl;
+            }
+        } else if(option == 4) {
+            batchRepairBenchmark(graph, paths, seed, allow_negative);
+        } else if(option != 0) {
+            std::cout << "Nieprawidlowa opcja!" << std::endl;
+        }
+    } while(option != 0);
+    
+    delete[] output.dist;
+    delete[] output.parent;
+}
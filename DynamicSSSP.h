@@ -0,0 +1,88 @@
+#ifndef DYNAMICSSSP_H
+#define DYNAMICSSSP_H
+
+#include "Algorithms.h"
+
+class MinHeap;
+
+// Zmiana luku w partii: wagi przed i po zmianie (0 - brak krawedzi)
+struct ArcUpdate {
+    int start, end;
+    int old_weight, new_weight;
+};
+
+// Najkrotsze sciezki z wierzcholka startowego grafu skierowanego naprawiane po partii
+// zmian krawedzi (wstawienia, zmniejszenia i zwiekszenia wag, usuniecia) zamiast
+// liczenia od nowa. Punktem wyjscia sa dist/parent z pelnego przebiegu algorytmu.
+// - zwiekszenie wagi / usuniecie luku drzewa: poddrzewo konca luku traci odleglosci
+//   (jak w Ramalingam-Reps), ktore odtwarzane sa od sasiadow spoza poddrzewa
+// - zmniejszenie wagi / wstawienie: relaksacja luku i propagacja od jego konca
+// Propagacja: kopiec (Dijkstra, wagi nieujemne) albo kolejka FIFO z licznikiem wstawien
+// wykrywajacym cykl ujemny (Bellman-Ford). Po wykryciu cyklu struktura wymaga reset().
+class DynamicShortestPaths {
+private:
+    Graph& graph;
+    int vertices;
+    int start_vertex;
+    bool label_correcting; // kolejka FIFO (ujemne wagi) zamiast kopca
+    bool valid;
+    int* dist;
+    int* parent;
+    
+    // Drzewo sciezek jako listy dzieci (przepinanie wierzcholka w O(1))
+    int* first_child;
+    int* next_sibling;
+    int* previous_sibling;
+    
+    ArcUpdate* pending;
+    int pending_count;
+    int pending_capacity;
+    
+    int* affected;     // znacznik poddrzewa do odtworzenia (stamp)
+    int affected_stamp;
+    int* stack;
+    MinHeap* heap;
+    int* queue;
+    int queue_head;
+    int queue_size;
+    bool* in_queue;
+    int* enqueued;     // liczba wstawien do kolejki w biezacej naprawie
+    int* touched;      // wierzcholki z niezerowym enqueued
+    int touched_count;
+    bool cycle_found;
+    int last_touched;
+    
+    void setParent(int vertex, int new_parent);
+    void detach(int vertex);
+    int collectAffected(int root, int count);
+    void seedAffected(int count);
+    void relax(int from, int to, int weight);
+    void push(int vertex);
+    bool propagate();
+    
+public:
+    DynamicShortestPaths(Graph& g, bool allow_negative);
+    ~DynamicShortestPaths();
+    
+    // Stan poczatkowy z pelnego przebiegu (negative_cycle - stan niewazny do nastepnego reset)
+    void reset(const int* initial_dist, const int* initial_parent, bool negative_cycle);
+    
+    // Zmiana luku w grafie zapamietana do najblizszej naprawy; weight 0 usuwa luk.
+    // Zwraca false dla blednych parametrow lub zmiany bez efektu.
+    bool update(int start, int end, int weight);
+    
+    // Naprawa po wszystkich zapamietanych zmianach; false - cykl ujemny (stan niewazny)
+    bool repair();
+    
+    bool isValid() const { return valid; }
+    int getPendingCount() const { return pending_count; }
+    int getLastTouched() const { return last_touched; }
+    const int* getDist() const { return dist; }
+    const int* getParent() const { return parent; }
+};
+
+// Opcje dodatkowe algorytmow najkrotszych sciezek: partie zmian krawedzi z naprawa
+// sciezek oraz porownanie czasu naprawy z pelnym przeliczeniem algorytmem seed
+void dynamicShortestPathsMenu(Graph& graph, const AlgorithmInfo& seed, bool allow_negative);
+
+#endif
@@ -0,0 +1,846 @@
+#include "Graph.h"
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <cstdlib>
+#include <chrono>
+#include <iomanip>
+#include "Reordering.h"
+#include "CsrBuilder.h"
+#include "Parallel.h"
+
+const char* graphKindName(int kind) {
+    switch(kind) {
+        case GRAPH_UNDIRECTED: return "nieskierowany";
+        case GRAPH_DIRECTED: return "skierowany";
+        case GRAPH_DIRECTED_NEGATIVE: return "skierowany z ujemnymi wagami";
+        default: return "?";
+    }
+}
+
+const char* weightWidthName(int width) {
+    switch(width) {
+        case WEIGHT_INT8: return "int8";
+        case WEIGHT_INT16: return "int16";
+        case WEIGHT_INT32: return "int32";
+        default: return "?";
+    }
+}
+
+int narrowestWeightWidth(int max_abs_weight) {
+    if(max_abs_weight <= INT8_MAX) return WEIGHT_INT8;
+    if(max_abs_weight <= INT16_MAX) return WEIGHT_INT16;
+    return WEIGHT_INT32;
+}
+
+int weightMagnitude(int weight) {
+    return weight == INT_MIN ? INT_MAX : abs(weight);
+}
+
+Graph::Graph(int v, bool is_directed) : vertices(v), edges_count(0), start_vertex(0), directed(is_directed),
+                                        negative_weights(false), version(0), random_state(1),
+                                        adjacency_list(nullptr), list_sizes(nullptr), list_capacity(nullptr),
+                                        original_id(nullptr), current_id(nullptr),
+                                        adjacency_matrix(nullptr), matrix_valid(false), bits_valid(false),
+                                        edge_list(nullptr), edge_list_capacity(0), edges_valid(false),
+                                        csr_offsets(nullptr), csr_targets(nullptr), csr_weights(nullptr),
+                                        rcsr_offsets(nullptr), rcsr_targets(nullptr), rcsr_weights(nullptr),
+                                        csr_valid(false), rcsr_valid(false), max_abs_weight(0) {
+    reallocateMemory(v, is_directed);
+}
+
+Graph::~Graph() {
+    freeMemory();
+}
+
+void Graph::freeCSR() {
+    delete[] csr_offsets;
+    delete[] csr_targets;
+    delete[] csr_weights;
+    delete[] rcsr_offsets;
+    delete[] rcsr_targets;
+    delete[] rcsr_weights;
+    csr_offsets = csr_targets = csr_weights = nullptr;
+    rcsr_offsets = rcsr_targets = rcsr_weights = nullptr;
+    csr_valid = false;
+    rcsr_valid = false;
+}
+
+// Struktury budowane od nowa po kazdej zmianie grafu
+void Graph::invalidateDerived() {
+    csr_valid = false;
+    rcsr_valid = false;
+    invalidateWeightArrays();
+}
+
+void Graph::invalidateWeightArrays() {
+    narrow_matrix.valid = false;
+    triangular_matrix.valid = false;
+}
+
+void Graph::freeMemory() {
+    freeCSR();
+    adjacency_bits.release();
+    bits_valid = false;
+    narrow_matrix.release();
+    triangular_matrix.release();
+    delete[] edge_list;
+    edge_list = nullptr;
+    edge_list_capacity = 0;
+    edges_valid = false;
+    if(adjacency_matrix) {
+        for(int i = 0; i < vertices; i++) delete[] adjacency_matrix[i];
+        delete[] adjacency_matrix;
+        adjacency_matrix = nullptr;
+        matrix_valid = false;
+    }
+    if(adjacency_list) {
+        for(int i = 0; i < vertices; i++) delete[] adjacency_list[i];
+        delete[] adjacency_list;
+        delete[] list_sizes;
+        delete[] list_capacity;
+        delete[] original_id;
+        delete[] current_id;
+        adjacency_list = nullptr;
+    }
+}
+
+// Czyszczenie bez zwalniania: w zbudowanej macierzy zerowane sa tylko pola istniejacych
+// krawedzi (wg listy sasiedztwa), wiec koszt jest O(E) zamiast O(V^2)
+void Graph::clearMemory() {
+    freeCSR();
+    invalidateWeightArrays();
+    edges_valid = false;
+    for(int u = 0; u < vertices; u++) {
+        if(matrix_valid) {
+            for(int j = 0; j < list_sizes[u]; j++) {
+                adjacency_matrix[u][adjacency_list[u][j * 2]] = 0;
+            }
+        }
+        list_sizes[u] = 0;
+        original_id[u] = u;
+        current_id[u] = u;
+    }
+    matrix_valid = false;
+    bits_valid = false;
+    edges_count = 0;
+}
+
+void Graph::prepare(int v, bool is_directed) {
+    reallocateMemory(v, is_directed);
+}
+
+void Graph::reallocateMemory(int new_vertices, bool new_directed) {
+    // Ten sam rozmiar (kolejne instancje testow) - bufory czyszczone w miejscu
+    bool reuse = (adjacency_list != nullptr && new_vertices == vertices);
+    if(reuse) {
+        clearMemory();
+    } else {
+        freeMemory();
+    }
+    
+    vertices = new_vertices;
+    directed = new_directed;
+    negative_weights = false;
+    max_abs_weight = 0;
+    start_vertex = 0;
+    version++;
+    if(reuse) return;
+    
+    // Macierz i lista krawedzi powstaja dopiero przy pierwszym uzyciu
+    adjacency_list = new int*[vertices];
+    list_sizes = new int[vertices];
+    list_capacity = new int[vertices];
+    for(int i = 0; i < vertices; i++) {
+        adjacency_list[i] = nullptr; // [sasiad, waga, sasiad, waga, ...]
+        list_sizes[i] = 0;
+        list_capacity[i] = 0;
+    }
+    edges_count = 0;
+    
+    original_id = new int[vertices];
+    current_id = new int[vertices];
+    for(int i = 0; i < vertices; i++) {
+        original_id[i] = i;
+        current_id[i] = i;
+    }
+}
+
+// Kolejna liczba calkowita tekstu zakonczonego zerem; false na koncu danych lub przy bledzie
+static bool parseInt(const char*& text, int& value) {
+    char* end;
+    long parsed = strtol(text, &end, 10);
+    if(end == text) return false;
+    value = (int)parsed;
+    text = end;
+    return true;
+}
+
+bool Graph::loadFromFile(const std::string& filename) {
+    std::ifstream file(filename);
+    if(!file.is_open()) {
+        std::cout << "Blad: Nie mozna otworzyc pliku " << filename << std::endl;
+        return false;
+    }
+    
+    // Liczba pol naglowka rozroznia graf nieskierowany (E V) od skierowanego (E V start)
+    std::string header;
+    std::getline(file, header);
+    std::istringstream header_stream(header);
+    int fields[3] = {0, 0, 0};
+    int field_count = 0;
+    while(field_count < 3 && header_stream >> fields[field_count]) {
+        field_count++;
+    }
+    if(field_count < 2) {
+        std::cout << "Blad: Nieprawidlowy naglowek pliku " << filename << std::endl;
+        return false;
+    }
+    
+    int file_edges = fields[0];
+    int file_vertices = fields[1];
+    if(file_edges < 0 || file_vertices < 1) {
+        std::cout << "Blad: Nieprawidlowy naglowek pliku " << filename << std::endl;
+        return false;
+    }
+    
+    // Reszta pliku wczytana naraz i przetwarzana strtol (strumien >> jest wielokrotnie wolniejszy)
+    file.clear(); // naglowek bez konca linii ustawia eof
+    std::streampos body_start = file.tellg();
+    file.seekg(0, std::ios::end);
+    size_t body_size = (size_t)(file.tellg() - body_start);
+    file.seekg(body_start);
+    char* body = new char[body_size + 1];
+    file.read(body, body_size);
+    body[file.gcount()] = '\0';
+    file.close();
+    
+    reallocateMemory(file_vertices, field_count == 3);
+    start_vertex = (field_count == 3) ? fields[2] : 0;
+    // Start spoza grafu zastepowany wierzcholkiem 0 (jak konce krawedzi - zgloszony, nie blad)
+    bool start_out_of_range = start_vertex < 0 || start_vertex >= vertices;
+    if(start_out_of_range) start_vertex = 0;
+    
+    // Krawedzie do listy krawedzi z pominieciem petli (niewidocznych w macierzy - zero na
+    // przekatnej), wag 0 (0 w macierzy oznacza brak krawedzi) i koncow spoza grafu
+    reserveEdgeList(file_edges);
+    int count = 0, read = 0, self_loops = 0, zero_weights = 0, out_of_range = 0;
+    const char* text = body;
+    while(read < file_edges) {
+        int start, end, weight;
+        if(!parseInt(text, start) || !parseInt(text, end) || !parseInt(text, weight)) break;
+        read++;
+        if(start < 0 || end < 0 || start >= vertices || end >= vertices) out_of_range++;
+        else if(start == end) self_loops++;
+        else if(weight == 0) zero_weights++;
+        else edge_list[count++] = Edge(start, end, weight);
+    }
+    delete[] body;
+    
+    // Powtorzone krawedzie scalane przy budowie CSR (sortowanie wierszy, najmniejsza waga),
+    // wiec macierz i lista zawieraja te same krawedzie
+    int duplicates = buildFromEdgeList(count, CSR_REMOVE_DUPLICATES, 0);
+    
+    std::cout << "Graf " << (directed ? "skierowany" : "nieskierowany") << " wczytany z pliku";
+    if(directed) std::cout << " (wierzcholek startowy: " << start_vertex << ")";
+    std::cout << ", wagi macierzy: " << weightWidthName(getWeightWidth());
+    std::cout << ". Reprezentacje:" << std::endl;
+    if(read < file_edges) {
+        std::cout << "Uwaga: plik zawiera " << read << " z " << file_edges << " krawedzi naglowka" << std::endl;
+    }
+    if(start_out_of_range) {
+        std::cout << "Uwaga: wierzcholek startowy " << fields[2] << " spoza grafu (0.." << vertices - 1
+                  << ") - przyjeto 0" << std::endl;
+    }
+    if(duplicates || self_loops || zero_weights || out_of_range) {
+        std::cout << "Pominiete krawedzie: duplikaty = " << duplicates << " (zachowana najmniejsza waga), petle = "
+                  << self_loops << ", wagi 0 = " << zero_weights << ", konce spoza grafu = " << out_of_range
+                  << "; krawedzi w grafie: " << edges_count << std::endl;
+    }
+    displayMatrix();
+    displayList();
+    return true;
+}
+
+// Prywatny generator grafu (xorshift64*): kazdy graf losuje niezaleznie od rand(),
+// wiec instancje moga powstawac rownolegle w wielu watkach
+void Graph::seedRandom(unsigned int seed) {
+    // splitmix64 - rozne stany poczatkowe takze dla sasiednich ziaren
+    unsigned long long z = seed + 0x9E3779B97F4A7C15ULL;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    random_state = (z ^ (z >> 31)) | 1;
+}
+
+int Graph::nextRandom() {
+    random_state ^= random_state >> 12;
+    random_state ^= random_state << 25;
+    random_state ^= random_state >> 27;
+    return (int)((random_state * 0x2545F4914F6CDD1DULL) >> 33); // 31 bitow, jak rand()
+}
+
+// Waga krawedzi: 1..100 lub -100..99 z pominieciem zera - zero w macierzy oznacza
+// brak krawedzi, wiec krawedz o wadze 0 bylaby widoczna tylko w liscie sasiedztwa
+int Graph::randomWeight(bool allow_negative) {
+    if(!allow_negative) return nextRandom() % 100 + 1;
+    int weight;
+    do {
+        weight = (nextRandom() % 200) - 100;
+    } while(weight == 0);
+    return weight;
+}
+
+void Graph::generateRandom(int v, int density, int kind) {
+    generateRandomForTesting(v, density, kind);
+    
+    std::cout << "Graf " << graphKindName(kind) << " wygenerowany losowo (" << vertices << " wierzcholkow, "
+              << density << "% gestosci, " << edges_count << " krawedzi, wagi macierzy: " << weightWidthName(getWeightWidth());
+    if(directed) std::cout << ", start: " << start_vertex;
+    std::cout << ")" << std::endl;
+    displayMatrix();
+    displayList();
+}
+
+void Graph::generateRandomForTesting(int v, int density, int kind) {
+    generateRandomForTesting(v, density, kind, (unsigned int)rand());
+}
+
+void Graph::generateRandomForTesting(int v, int density, int kind, unsigned int seed) {
+    generateRandomForTesting(v, density, kind, seed, 0);
+}
+
+void Graph::generateRandomForTesting(int v, int density, int kind, unsigned int seed, int num_threads) {
+    seedRandom(seed);
+    reallocateMemory(v, kind != GRAPH_UNDIRECTED);
+    bool allow_negative = (kind == GRAPH_DIRECTED_NEGATIVE);
+    
+    long long max_edges = (long long)vertices * (vertices - 1);
+    if(!directed) max_edges /= 2;
+    long long target_edges = (max_edges * density) / 100;
+    
+    // Krawedzie losowane do listy krawedzi, duplikaty odrzucane wg mapy bitowej (pusta na
+    // starcie); reprezentacje budowane naraz z gotowej listy
+    reserveEdgeList(target_edges > vertices ? (int)target_edges : vertices);
+    buildAdjacencyBitmap();
+    int count = 0;
+    auto stage = [&](int start, int end, int weight) {
+        edge_list[count++] = Edge(start, end, weight);
+        adjacency_bits.set(start, end);
+        if(!directed) adjacency_bits.set(end, start);
+    };
+    
+    if(directed) {
+        // Generowanie cyklu dla spojnosci
+        for(int i = 0; i < vertices && vertices > 1; i++) {
+            int next = (i + 1) % vertices;
+            stage(i, next, randomWeight(allow_negative));
+        }
+    } else {
+        // Generowanie drzewa rozpinajacego dla spojnosci
+        for(int i = 1; i < vertices; i++) {
+            int parent = nextRandom() % i;
+            stage(parent, i, randomWeight(allow_negative));
+        }
+    }
+    
+    // Dodawanie pozostalych krawedzi
+    while(count < target_edges) {
+        int start = nextRandom() % vertices;
+        int end = nextRandom() % vertices;
+        
+        if(start != end && !adjacency_bits.test(start, end)) {
+            stage(start, end, randomWeight(allow_negative));
+        }
+    }
+    buildFromEdgeList(count, 0, num_threads);
+}
+
+void Graph::reserveEdgeList(int count) {
+    if(edge_list_capacity >= count) return;
+    delete[] edge_list;
+    edge_list = new Edge[count];
+    edge_list_capacity = count;
+}
+
+// Pusty graf (po reallocateMemory) z krawedzi edge_list[0..count): CSR budowany rownolegle
+// z listy krawedzi, z niego rownolegle kopiowane wiersze listy sasiedztwa. Bez flag kolejnosc
+// sasiadow jest taka, jak przy dodawaniu krawedzi po kolei przez addEdge.
+// Zwraca liczbe krawedzi scalonych przez CSR_REMOVE_DUPLICATES (petle musza byc juz pominiete:
+// w grafie nieskierowanym scalony duplikat znika z wierszy obu koncow).
+// num_threads < 1 - domyslna liczba watkow.
+int Graph::buildFromEdgeList(int count, int flags, int num_threads) {
+    int threads = csrThreadCount(count, num_threads);
+    CsrArrays csr = buildCsrFromEdges(edge_list, count, vertices, !directed, flags, threads);
+    freeCSR();
+    csr_offsets = csr.offsets;
+    csr_targets = csr.targets;
+    csr_weights = csr.weights;
+    csr_valid = true;
+    
+    parallelFor(vertices, threads, [this](int u, int) {
+        int degree = csr_offsets[u + 1] - csr_offsets[u];
+        if(list_capacity[u] < degree) {
+            delete[] adjacency_list[u];
+            adjacency_list[u] = new int[degree * 2];
+            list_capacity[u] = degree;
+        }
+        int* row = adjacency_list[u];
+        for(int i = 0; i < degree; i++) {
+            row[i * 2] = csr_targets[csr_offsets[u] + i];
+            row[i * 2 + 1] = csr_weights[csr_offsets[u] + i];
+        }
+        list_sizes[u] = degree;
+    });
+    
+    // Graf nieskierowany: krawedz w wierszach obu koncow (petla dwa razy w jednym wierszu)
+    edges_count = directed ? csr_offsets[vertices] : csr_offsets[vertices] / 2;
+    for(int i = 0; i < count; i++) {
+        int weight = edge_list[i].weight;
+        if(weight < 0) negative_weights = true;
+        if(weightMagnitude(weight) > max_abs_weight) max_abs_weight = weightMagnitude(weight);
+        if(bits_valid) {
+            adjacency_bits.set(edge_list[i].start, edge_list[i].end);
+            if(!directed) adjacency_bits.set(edge_list[i].end, edge_list[i].start);
+        }
+    }
+    
+    // Po scaleniu duplikatow lista krawedzi nie odpowiada grafowi - zbudowana zostanie od nowa
+    edges_valid = csr.removed == 0;
+    invalidateWeightArrays();
+    version++;
+    return directed ? csr.removed : csr.removed / 2;
+}
+
+// Lista sasiedztwa: [sasiad, waga, sasiad, waga, ...]
+void Graph::appendToList(int vertex, int neighbor, int weight) {
+    if(list_sizes[vertex] == list_capacity[vertex]) {
+        int capacity = list_capacity[vertex] ? list_capacity[vertex] * 2 : 4;
+        int* row = new int[capacity * 2];
+        for(int i = 0; i < list_sizes[vertex] * 2; i++) row[i] = adjacency_list[vertex][i];
+        delete[] adjacency_list[vertex];
+        adjacency_list[vertex] = row;
+        list_capacity[vertex] = capacity;
+    }
+    adjacency_list[vertex][list_sizes[vertex] * 2] = neighbor;
+    adjacency_list[vertex][list_sizes[vertex] * 2 + 1] = weight;
+    list_sizes[vertex]++;
+}
+
+void Graph::addEdge(int start, int end, int weight) {
+    appendToList(start, end, weight);
+    
+    // Graf nieskierowany - krawedz widoczna z obu koncow
+    if(!directed) appendToList(end, start, weight);
+    
+    // Reprezentacje juz zbudowane sa uzupelniane w miejscu
+    if(matrix_valid) {
+        adjacency_matrix[start][end] = weight;
+        if(!directed) adjacency_matrix[end][start] = weight;
+    }
+    if(bits_valid) {
+        adjacency_bits.set(start, end);
+        if(!directed) adjacency_bits.set(end, start);
+    }
+    if(edges_valid) {
+        if(edges_count == edge_list_capacity) {
+            int capacity = edge_list_capacity ? edge_list_capacity * 2 : 16;
+            Edge* grown = new Edge[capacity];
+            for(int i = 0; i < edges_count; i++) grown[i] = edge_list[i];
+            delete[] edge_list;
+            edge_list = grown;
+            edge_list_capacity = capacity;
+        }
+        edge_list[edges_count] = Edge(start, end, weight);
+    }
+    edges_count++;
+    
+    if(weight < 0) negative_weights = true;
+    if(weightMagnitude(weight) > max_abs_weight) max_abs_weight = weightMagnitude(weight);
+    invalidateDerived();
+    version++;
+}
+
+// Wymiana z ostatnim elementem wiersza - kolejnosc sasiadow nie ma znaczenia
+void Graph::removeFromList(int vertex, int neighbor) {
+    int* row = adjacency_list[vertex];
+    for(int i = 0; i < list_sizes[vertex]; i++) {
+        if(row[i * 2] == neighbor) {
+            int last = --list_sizes[vertex];
+            row[i * 2] = row[last * 2];
+            row[i * 2 + 1] = row[last * 2 + 1];
+            return;
+        }
+    }
+}
+
+void Graph::setListWeight(int vertex, int neighbor, int weight) {
+    int* row = adjacency_list[vertex];
+    for(int i = 0; i < list_sizes[vertex]; i++) {
+        if(row[i * 2] == neighbor) {
+            row[i * 2 + 1] = weight;
+            return;
+        }
+    }
+}
+
+int Graph::getEdgeWeight(int start, int end) const {
+    if(matrix_valid) return adjacency_matrix[start][end];
+    if(bits_valid && !adjacency_bits.test(start, end)) return 0;
+    const int* row = adjacency_list[start];
+    for(int i = 0; i < list_sizes[start]; i++) {
+        if(row[i * 2] == end) return row[i * 2 + 1];
+    }
+    return 0;
+}
+
+Edge Graph::getListEntry(int entry) const {
+    int u = 0;
+    while(entry >= list_sizes[u]) entry -= list_sizes[u++];
+    return Edge(u, adjacency_list[u][entry * 2], adjacency_list[u][entry * 2 + 1]);
+}
+
+bool Graph::insertEdge(int start, int end, int weight) {
+    if(start < 0 || end < 0 || start >= vertices || end >= vertices || start == end || weight == 0) return false;
+    if(getEdgeWeight(start, end) != 0) return false;
+    addEdge(start, end, weight);
+    return true;
+}
+
+// Flaga ujemnych wag nie jest cofana przy usuwaniu - pozostaje zachowawcza
+bool Graph::removeEdge(int start, int end) {
+    if(start < 0 || end < 0 || start >= vertices || end >= vertices) return false;
+    if(getEdgeWeight(start, end) == 0) return false;
+    
+    removeFromList(start, end);
+    if(!directed) removeFromList(end, start);
+    if(matrix_valid) {
+        adjacency_matrix[start][end] = 0;
+        if(!directed) adjacency_matrix[end][start] = 0;
+    }
+    if(bits_valid) {
+        adjacency_bits.clear(start, end);
+        if(!directed) adjacency_bits.clear(end, start);
+    }
+    edges_count--;
+    
+    // Pozycja krawedzi w liscie krawedzi nie jest znana - lista budowana od nowa przy uzyciu
+    edges_valid = false;
+    invalidateDerived();
+    version++;
+    return true;
+}
+
+bool Graph::setEdgeWeight(int start, int end, int weight) {
+    if(start < 0 || end < 0 || start >= vertices || end >= vertices || weight == 0) return false;
+    if(getEdgeWeight(start, end) == 0) return false;
+    
+    setListWeight(start, end, weight);
+    if(!directed) setListWeight(end, start, weight);
+    if(matrix_valid) {
+        adjacency_matrix[start][end] = weight;
+        if(!directed) adjacency_matrix[end][start] = weight;
+    }
+    edges_valid = false;
+    
+    if(weight < 0) negative_weights = true;
+    if(weightMagnitude(weight) > max_abs_weight) max_abs_weight = weightMagnitude(weight);
+    invalidateDerived();
+    version++;
+    return true;
+}
+
+void Graph::displayMatrix() {
+    if(vertices > 20) {
+        std::cout << "\nGraf zbyt duzy do wyswietlenia macierzy (>20 wierzcholkow)" << std::endl;
+        return;
+    }
+    
+    std::cout << "\nReprezentacja macierzowa:" << std::endl;
+    std::cout << "   ";
+    for(int i = 0; i < vertices; i++) {
+        std::cout << i << "  ";
+    }
+    std::cout << std::endl;
+    
+    for(int i = 0; i < vertices; i++) {
+        std::cout << i << ": ";
+        for(int j = 0; j < vertices; j++) {
+            std::cout << getEdgeWeight(i, j) << "  ";
+        }
+        std::cout << std::endl;
+    }
+}
+
+void Graph::displayList() {
+    if(vertices > 20) {
+        std::cout << "\nGraf zbyt duzy do wyswietlenia listy (>20 wierzcholkow)" << std::endl;
+        return;
+    }
+    
+    std::cout << "\nReprezentacja listowa" << (directed ? " (graf skierowany)" : "") << ":" << std::endl;
+    for(int i = 0; i < vertices; i++) {
+        std::cout << i << ": ";
+        for(int j = 0; j < list_sizes[i]; j++) {
+            int neighbor = adjacency_list[i][j * 2];
+            int weight = adjacency_list[i][j * 2 + 1];
+            std::cout << "(" << neighbor << "," << weight << ") ";
+        }
+        std::cout << std::endl;
+    }
+}
+
+// Macierz z listy sasiedztwa. Bufor zostaje przydzielony do zmiany rozmiaru grafu,
+// a nieaktualny jest wyzerowany (clearMemory), wiec wpisywane sa tylko krawedzie.
+void Graph::buildMatrix() {
+    if(matrix_valid) return;
+    if(!adjacency_matrix) {
+        adjacency_matrix = new int*[vertices];
+        for(int i = 0; i < vertices; i++) {
+            adjacency_matrix[i] = new int[vertices];
+            for(int j = 0; j < vertices; j++) {
+                adjacency_matrix[i][j] = 0;
+            }
+        }
+    }
+    for(int u = 0; u < vertices; u++) {
+        for(int j = 0; j < list_sizes[u]; j++) {
+            adjacency_matrix[u][adjacency_list[u][j * 2]] = adjacency_list[u][j * 2 + 1];
+        }
+    }
+    matrix_valid = true;
+}
+
+void Graph::buildAdjacencyBitmap() {
+    if(bits_valid) return;
+    adjacency_bits.reset(vertices);
+    for(int u = 0; u < vertices; u++) {
+        for(int j = 0; j < list_sizes[u]; j++) adjacency_bits.set(u, adjacency_list[u][j * 2]);
+    }
+    bits_valid = true;
+}
+
+// Lista krawedzi z list sasiedztwa (graf nieskierowany: krawedz z wiersza mniejszego konca)
+void Graph::buildEdgeList() {
+    if(edges_valid) return;
+    reserveEdgeList(edges_count);
+    int count = 0;
+    for(int u = 0; u < vertices; u++) {
+        for(int j = 0; j < list_sizes[u]; j++) {
+            int neighbor = adjacency_list[u][j * 2];
+            if(directed || u < neighbor) edge_list[count++] = Edge(u, neighbor, adjacency_list[u][j * 2 + 1]);
+        }
+    }
+    edges_valid = true;
+}
+
+// Budowa CSR wprzod (wiersze listy sasiedztwa jeden za drugim, kopiowane rownolegle)
+void Graph::buildCSR() {
+    if(csr_valid) return;
+    freeCSR();
+    
+    int total = 0;
+    for(int u = 0; u < vertices; u++) total += list_sizes[u];
+    
+    csr_offsets = new int[vertices + 1];
+    csr_targets = new int[total];
+    csr_weights = new int[total];
+    
+    csr_offsets[0] = 0;
+    for(int u = 0; u < vertices; u++) csr_offsets[u + 1] = csr_offsets[u] + list_sizes[u];
+    parallelFor(vertices, csrThreadCount(total, 0), [this](int u, int) {
+        int base = csr_offsets[u];
+        for(int i = 0; i < list_sizes[u]; i++) {
+            csr_targets[base + i] = adjacency_list[u][i * 2];
+            csr_weights[base + i] = adjacency_list[u][i * 2 + 1];
+        }
+    });
+    
+    csr_valid = true;
+}
+
+// CSR grafu odwroconego: zliczenie stopni wejsciowych, sumy prefiksowe, rozproszenie krawedzi
+void Graph::buildReverseCSR() {
+    if(rcsr_valid) return;
+    buildCSR();
+    
+    int total = csr_offsets[vertices];
+    rcsr_offsets = new int[vertices + 1];
+    rcsr_targets = new int[total];
+    rcsr_weights = new int[total];
+    
+    for(int v = 0; v <= vertices; v++) rcsr_offsets[v] = 0;
+    for(int e = 0; e < total; e++) rcsr_offsets[csr_targets[e] + 1]++;
+    for(int v = 0; v < vertices; v++) rcsr_offsets[v + 1] += rcsr_offsets[v];
+    
+    int* fill = new int[vertices];
+    for(int v = 0; v < vertices; v++) fill[v] = rcsr_offsets[v];
+    for(int u = 0; u < vertices; u++) {
+        for(int e = csr_offsets[u]; e < csr_offsets[u + 1]; e++) {
+            int pos = fill[csr_targets[e]]++;
+            rcsr_targets[pos] = u;
+            rcsr_weights[pos] = csr_weights[e];
+        }
+    }
+    delete[] fill;
+    
+    rcsr_valid = true;
+}
+
+// Zwarte macierze wypelniane wprost z list sasiedztwa - macierz int** nie jest potrzebna
+template<typename W>
+static void packMatrix(int** adjacency_list, const int* list_sizes, int vertices, W* packed) {
+    size_t cells = (size_t)vertices * vertices;
+    for(size_t i = 0; i < cells; i++) packed[i] = 0;
+    for(int u = 0; u < vertices; u++) {
+        W* row = packed + (size_t)u * vertices;
+        for(int j = 0; j < list_sizes[u]; j++) row[adjacency_list[u][j * 2]] = (W)adjacency_list[u][j * 2 + 1];
+    }
+}
+
+template<typename W>
+static void packTriangle(int** adjacency_list, const int* list_sizes, int vertices, W* packed) {
+    size_t cells = triangularRowOffset(vertices, vertices);
+    for(size_t i = 0; i < cells; i++) packed[i] = 0;
+    for(int u = 0; u < vertices; u++) {
+        W* row = packed + triangularRowOffset(u, vertices);
+        for(int j = 0; j < list_sizes[u]; j++) {
+            int v = adjacency_list[u][j * 2];
+            if(v > u) row[v - u - 1] = (W)adjacency_list[u][j * 2 + 1];
+        }
+    }
+}
+
+// Zwarta macierz w najwezszym typie wag, razem z mapa bitowa wskazujaca niezerowe pola
+void Graph::buildNarrowMatrix() {
+    buildAdjacencyBitmap();
+    if(narrow_matrix.valid) return;
+    int width = getWeightWidth();
+    narrow_matrix.reserve(width, (size_t)vertices * vertices);
+    if(width == WEIGHT_INT8) packMatrix(adjacency_list, list_sizes, vertices, narrow_matrix.data<int8_t>());
+    else if(width == WEIGHT_INT16) packMatrix(adjacency_list, list_sizes, vertices, narrow_matrix.data<int16_t>());
+    else packMatrix(adjacency_list, list_sizes, vertices, narrow_matrix.data<int32_t>());
+    narrow_matrix.valid = true;
+}
+
+// Gorny trojkat (bez przekatnej) - polowa pamieci pelnej macierzy grafu nieskierowanego
+void Graph::buildTriangularMatrix() {
+    if(triangular_matrix.valid) return;
+    int width = getWeightWidth();
+    triangular_matrix.reserve(width, triangularRowOffset(vertices, vertices));
+    if(width == WEIGHT_INT8) packTriangle(adjacency_list, list_sizes, vertices, triangular_matrix.data<int8_t>());
+    else if(width == WEIGHT_INT16) packTriangle(adjacency_list, list_sizes, vertices, triangular_matrix.data<int16_t>());
+    else packTriangle(adjacency_list, list_sizes, vertices, triangular_matrix.data<int32_t>());
+    triangular_matrix.valid = true;
+}
+
+// Zmiana numeracji: wierzcholek u dostaje numer new_id[u]. Lista i zbudowane juz macierz
+// i lista krawedzi sa przepisywane (sasiedzi w wierszach posortowani rosnaco), a original_id
+// pozwala raportowac wyniki w numeracji wejsciowej.
+void Graph::relabelVertices(const int* new_id) {
+    int* buffer = new int[vertices];
+    
+    // Macierz: permutacja kolumn w kazdym wierszu, nastepnie permutacja wierszy
+    // (nieaktualna macierz jest wyzerowana - bez zmian)
+    if(matrix_valid) {
+        int** new_matrix = new int*[vertices];
+        for(int u = 0; u < vertices; u++) {
+            for(int v = 0; v < vertices; v++) {
+                buffer[new_id[v]] = adjacency_matrix[u][v];
+            }
+            for(int v = 0; v < vertices; v++) {
+                adjacency_matrix[u][v] = buffer[v];
+            }
+            new_matrix[new_id[u]] = adjacency_matrix[u];
+        }
+        delete[] adjacency_matrix;
+        adjacency_matrix = new_matrix;
+    }
+    
+    // Lista: wiersze przenoszone pod nowe numery, sasiedzi przenumerowani
+    int** new_list = new int*[vertices];
+    int* new_sizes = new int[vertices];
+    int* new_capacity = new int[vertices];
+    for(int u = 0; u < vertices; u++) {
+        int* row = adjacency_list[u];
+        for(int j = 0; j < list_sizes[u]; j++) {
+            row[j * 2] = new_id[row[j * 2]];
+        }
+        heapSortRecords(row, list_sizes[u], 2, nullptr);
+        new_list[new_id[u]] = row;
+        new_sizes[new_id[u]] = list_sizes[u];
+        new_capacity[new_id[u]] = list_capacity[u];
+    }
+    delete[] adjacency_list;
+    delete[] list_sizes;
+    delete[] list_capacity;
+    adjacency_list = new_list;
+    list_sizes = new_sizes;
+    list_capacity = new_capacity;
+    
+    if(edges_valid) {
+        for(int i = 0; i < edges_count; i++) {
+            edge_list[i].start = new_id[edge_list[i].start];
+            edge_list[i].end = new_id[edge_list[i].end];
+        }
+    }
+    
+    for(int u = 0; u < vertices; u++) {
+        buffer[new_id[u]] = original_id[u];
+    }
+    for(int u = 0; u < vertices; u++) {
+        original_id[u] = buffer[u];
+        current_id[original_id[u]] = u;
+    }
+    start_vertex = new_id[start_vertex];
+    
+    delete[] buffer;
+    freeCSR();
+    invalidateWeightArrays();
+    bits_valid = false;
+    version++;
+}
+
+// Ustawienie wybranej numeracji (ORDER_ORIGINAL przywraca numeracje wejsciowa)
+void Graph::applyOrdering(int ordering) {
+    int* new_id = new int[vertices];
+    if(ordering == ORDER_ORIGINAL) {
+        for(int u = 0; u < vertices; u++) {
+            new_id[u] = original_id[u];
+        }
+    } else {
+        computeOrdering(ordering, vertices, adjacency_list, list_sizes, 2, new_id);
+    }
+    relabelVertices(new_id);
+    delete[] new_id;
+}
+
+void Graph::reorderVertices() {
+    int ordering;
+    std::cout << "\nZmiana numeracji wierzcholkow:" << std::endl;
+    std::cout << "0. Numeracja oryginalna" << std::endl;
+    std::cout << "1. Kolejnosc BFS" << std::endl;
+    std::cout << "2. Odwrocony Cuthill-McKee (RCM)" << std::endl;
+    std::cout << "3. Malejace stopnie" << std::endl;
+    std::cout << "Wybierz opcje: ";
+    std::cin >> ordering;
+    if(ordering < ORDER_ORIGINAL || ordering > ORDER_DEGREE) {
+        std::cout << "Nieprawidlowa opcja!" << std::endl;
+        return;
+    }
+    
+    double gap_before, gap_after;
+    int band_before, band_after;
+    orderingLocality(vertices, adjacency_list, list_sizes, 2, gap_before, band_before);
+    
+    auto start_time = std::chrono::high_resolution_clock::now();
+    applyOrdering(ordering);
+    auto end_time = std::chrono::high_resolution_clock::now();
+    double seconds = std::chrono::duration_cast<std::chrono::nanoseconds>(end_time - start_time).count() / 1000000000.0;
+    
+    orderingLocality(vertices, adjacency_list, list_sizes, 2, gap_after, band_after);
+    
+    std::cout << "Numeracja: " << orderingName(ordering) << ", czas = " << std::fixed << std::setprecision(6) << seconds << " sekund" << std::endl;
+    std::cout << "Srednia odleglosc numerow sasiadow: " << std::setprecision(1) << gap_before << " -> " << gap_after << std::endl;
+    std::cout << "Szerokosc pasma: " << band_before << " -> " << band_after << std::endl;
+    std::cout << "Wyniki algorytmow sa podawane w numeracji wejsciowej." << std::endl;
+}
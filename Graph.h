@@ -0,0 +1,298 @@
+#ifndef GRAPH_H
+#define GRAPH_H
+
+#include <string>
+#include <cstdint>
+#include <climits>
+
+struct Edge {
+    int start, end, weight;
+    
+    Edge() : start(0), end(0), weight(0) {}
+    Edge(int s, int e, int w) : start(s), end(e), weight(w) {}
+};
+
+// Rodzaj grafu: decyduje o sposobie generowania i o tym, ktore algorytmy moga na nim dzialac
+enum GraphKind {
+    GRAPH_UNDIRECTED = 0,        // nieskierowany, wagi 1..100 (MST)
+    GRAPH_DIRECTED = 1,          // skierowany, wagi 1..100 (Dijkstra)
+    GRAPH_DIRECTED_NEGATIVE = 2  // skierowany, wagi -100..99 bez zera (Bellman-Ford)
+};
+
+const char* graphKindName(int kind);
+
+// Typ wag zwartej macierzy: najwezszy typ calkowity mieszczacy wszystkie wagi grafu
+// (wagi generatora -100..100 mieszcza sie w 8 bitach - 4x mniej danych niz int)
+enum WeightWidth {
+    WEIGHT_INT8 = 0,
+    WEIGHT_INT16 = 1,
+    WEIGHT_INT32 = 2
+};
+
+const char* weightWidthName(int width);
+int narrowestWeightWidth(int max_abs_weight);
+// |weight| bez przepelnienia: INT_MIN daje INT_MAX (graf z taka waga i tak nie przejdzie
+// Graph::distancesFitInt)
+int weightMagnitude(int weight);
+
+// Tablica wag jednego z typow WeightWidth - przydzielona jest tylko tablica biezacego typu,
+// ponownie tylko przy zmianie typu lub rozmiaru (kolejne instancje testow uzywaja jej dalej)
+class WeightArray {
+private:
+    int width;
+    size_t cells;
+    int8_t* data8;
+    int16_t* data16;
+    int32_t* data32;
+    
+public:
+    bool valid;
+    
+    WeightArray() : width(WEIGHT_INT8), cells(0), data8(nullptr), data16(nullptr), data32(nullptr), valid(false) {}
+    ~WeightArray() { release(); }
+    
+    void release() {
+        delete[] data8;
+        delete[] data16;
+        delete[] data32;
+        data8 = nullptr;
+        data16 = nullptr;
+        data32 = nullptr;
+        cells = 0;
+        valid = false;
+    }
+    
+    void reserve(int new_width, size_t new_cells) {
+        if(new_width == width && new_cells == cells) return;
+        release();
+        if(new_width == WEIGHT_INT8) data8 = new int8_t[new_cells];
+        else if(new_width == WEIGHT_INT16) data16 = new int16_t[new_cells];
+        else data32 = new int32_t[new_cells];
+        width = new_width;
+        cells = new_cells;
+    }
+    
+    template<typename W> W* data() const;
+};
+
+template<> inline int8_t* WeightArray::data<int8_t>() const { return data8; }
+template<> inline int16_t* WeightArray::data<int16_t>() const { return data16; }
+template<> inline int32_t* WeightArray::data<int32_t>() const { return data32; }
+
+// Mapa bitowa sasiedztwa: bit (u, v) mowi tylko, czy istnieje krawedz u -> v (64 pary
+// na slowo, 32x mniej danych niz macierz int). Wiersz u to rowWords() slow od row(u);
+// petle po macierzy pomijaja puste slowa i przechodza po ustawionych bitach (lowestBit).
+class AdjacencyBitmap {
+private:
+    int vertices;
+    int words_per_row;
+    size_t capacity;
+    uint64_t* words;
+    
+public:
+    AdjacencyBitmap() : vertices(0), words_per_row(0), capacity(0), words(nullptr) {}
+    ~AdjacencyBitmap() { delete[] words; }
+    
+    // Pusta mapa dla v wierzcholkow (bufor przydzielany ponownie tylko przy wzroscie)
+    void reset(int v) {
+        vertices = v;
+        words_per_row = (v + 63) / 64;
+        size_t needed = (size_t)v * words_per_row;
+        if(needed > capacity) {
+            delete[] words;
+            words = new uint64_t[needed];
+            capacity = needed;
+        }
+        for(size_t i = 0; i < needed; i++) words[i] = 0;
+    }
+    
+    void release() {
+        delete[] words;
+        words = nullptr;
+        capacity = 0;
+    }
+    
+    void set(int u, int v) { words[(size_t)u * words_per_row + (v >> 6)] |= 1ULL << (v & 63); }
+    void clear(int u, int v) { words[(size_t)u * words_per_row + (v >> 6)] &= ~(1ULL << (v & 63)); }
+    bool test(int u, int v) const { return (words[(size_t)u * words_per_row + (v >> 6)] >> (v & 63)) & 1; }
+    const uint64_t* row(int u) const { return words + (size_t)u * words_per_row; }
+    int rowWords() const { return words_per_row; }
+};
+
+// Numer najmlodszego ustawionego bitu niezerowego slowa
+inline int lowestBit(uint64_t word) {
+    return __builtin_ctzll(word);
+}
+
+// Gorny trojkat macierzy nieskierowanej: wiersz u (sasiedzi v > u) zaczyna sie od
+// triangularRowOffset(u), waga (u, v) pod triangularRowOffset(u) + v - u - 1
+inline size_t triangularRowOffset(int u, int vertices) {
+    return (size_t)u * (2 * (size_t)vertices - u - 1) / 2;
+}
+
+// Jeden graf wspolny dla wszystkich algorytmow. Podstawa jest lista sasiedztwa
+// [sasiad, waga, sasiad, waga, ...] (graf nieskierowany: krawedz w obu wierszach),
+// pozostale reprezentacje powstaja na zadanie przy pierwszym uzyciu:
+// - macierz sasiedztwa (0 = brak krawedzi) - getMatrix(),
+// - lista krawedzi (kazda krawedz raz) - getEdges(),
+// - CSR wprzod i dla grafu odwroconego - buildCSR() / buildReverseCSR(),
+// - zwarte macierze wag - buildNarrowMatrix() / buildTriangularMatrix(),
+// - mapa bitowa sasiedztwa - buildAdjacencyBitmap() (generator buduje ja od razu).
+// Zbudowane macierz i mapa bitowa sa dalej aktualizowane przez zmiany pojedynczych krawedzi
+// (O(1) na zmiane), lista krawedzi tylko przy dodawaniu (dopisanie na koncu) - usuniecie
+// i zmiana wagi uniewazniaja ja, jak pozostale reprezentacje. Przebieg korzystajacy tylko
+// z list nie placi wiec za macierz V*V.
+// Kazda zmiana grafu zwieksza numer wersji, dzieki czemu algorytmy moga
+// uniewaznic zapamietane struktury pomocnicze (np. hierarchie skrotow).
+class Graph {
+private:
+    int vertices;
+    int edges_count;
+    int start_vertex;
+    bool directed;
+    bool negative_weights;
+    int version;
+    unsigned long long random_state;
+    int** adjacency_list;
+    int* list_sizes;
+    int* list_capacity; // wiersze listy rosna dwukrotnie przy zapelnieniu
+    int* original_id; // numer wierzcholka w danych wejsciowych (po zmianie numeracji)
+    int* current_id;  // odwrotnosc original_id
+    
+    // Macierz sasiedztwa budowana przez getMatrix(). Przydzielona, ale nieaktualna
+    // macierz jest zawsze wyzerowana, wiec ponowna budowa wpisuje tylko krawedzie.
+    int** adjacency_matrix;
+    bool matrix_valid;
+    
+    // Mapa bitowa istnienia krawedzi budowana przez buildAdjacencyBitmap()
+    AdjacencyBitmap adjacency_bits;
+    bool bits_valid;
+    
+    // Lista krawedzi budowana przez getEdges()
+    Edge* edge_list;
+    int edge_list_capacity;
+    bool edges_valid;
+    
+    // CSR (wiersze sasiadow w jednej tablicy) - wprzod i dla grafu odwroconego,
+    // budowane na zadanie przez buildCSR() / buildReverseCSR() i uniewazniane przy zmianie grafu
+    int* csr_offsets;
+    int* csr_targets;
+    int* csr_weights;
+    int* rcsr_offsets;
+    int* rcsr_targets;
+    int* rcsr_weights;
+    bool csr_valid;
+    bool rcsr_valid;
+    
+    // Zwarte macierze wag w typie wg WeightWidth, budowane na zadanie i uniewazniane przy
+    // zmianie grafu: pelna V*V (buildNarrowMatrix) oraz gorny trojkat V(V-1)/2 dla grafu
+    // nieskierowanego (buildTriangularMatrix)
+    int max_abs_weight; // nie maleje przy usuwaniu krawedzi (zachowawczo, jak negative_weights)
+    WeightArray narrow_matrix;
+    WeightArray triangular_matrix;
+    
+    void freeCSR();
+    void invalidateDerived();
+    void invalidateWeightArrays();
+    void freeMemory();
+    void clearMemory();
+    void reallocateMemory(int new_vertices, bool new_directed);
+    void reserveEdgeList(int count);
+    int buildFromEdgeList(int count, int flags, int num_threads);
+    void appendToList(int vertex, int neighbor, int weight);
+    void removeFromList(int vertex, int neighbor);
+    void setListWeight(int vertex, int neighbor, int weight);
+    void seedRandom(unsigned int seed);
+    int nextRandom();
+    int randomWeight(bool allow_negative);
+    
+public:
+    Graph(int v, bool is_directed);
+    ~Graph();
+    
+    // Pusty graf o v wierzcholkach; przy niezmienionym rozmiarze bufory sa
+    // czyszczone w miejscu zamiast zwalniane i przydzielane od nowa
+    void prepare(int v, bool is_directed);
+    
+    // Format pliku: naglowek "E V" (graf nieskierowany) lub "E V start" (graf skierowany),
+    // nastepnie E wierszy "poczatek koniec waga"
+    bool loadFromFile(const std::string& filename);
+    void generateRandom(int v, int density, int kind);
+    void generateRandomForTesting(int v, int density, int kind);
+    // Instancja wyznaczona wylacznie przez ziarno (bez rand(), bezpieczne w wielu watkach)
+    void generateRandomForTesting(int v, int density, int kind, unsigned int seed);
+    // num_threads - watki budowy reprezentacji (< 1 - domyslna liczba); testy wydajnosci
+    // podaja 1, aby budowa nie zabierala rdzeni mierzonym przebiegom
+    void generateRandomForTesting(int v, int density, int kind, unsigned int seed, int num_threads);
+    void addEdge(int start, int end, int weight);
+    
+    // Zmiany pojedynczych krawedzi grafu prostego (grafy dynamiczne). Zwracaja false,
+    // gdy krawedz juz istnieje (insertEdge), nie istnieje lub parametry sa bledne.
+    bool insertEdge(int start, int end, int weight);
+    bool removeEdge(int start, int end);
+    bool setEdgeWeight(int start, int end, int weight);
+    
+    void displayMatrix();
+    void displayList();
+    
+    void buildMatrix();
+    void buildAdjacencyBitmap();
+    void buildEdgeList();
+    void buildCSR();
+    void buildReverseCSR();
+    void buildNarrowMatrix();
+    void buildTriangularMatrix();
+    
+    void relabelVertices(const int* new_id);
+    void applyOrdering(int ordering);
+    void reorderVertices();
+    
+    int getVertices() const { return vertices; }
+    int getEdgeCount() const { return edges_count; }
+    int getStartVertex() const { return start_vertex; }
+    bool isDirected() const { return directed; }
+    bool hasNegativeWeights() const { return negative_weights; }
+    int getVersion() const { return version; }
+    int getMaxAbsWeight() const { return max_abs_weight; }
+    // Czy odleglosc sciezki prostej (najwyzej V-1 krawedzi) powiekszona o jeszcze jedna krawedz
+    // (suma przy relaksacji) miesci sie w int - tablice odleglosci algorytmow sa typu int
+    bool distancesFitInt() const { return (long long)max_abs_weight * vertices < INT_MAX; }
+    // To samo po wstawieniu krawedzi o wadze weight (max_abs_weight nie maleje przy cofnieciu zmiany)
+    bool distancesFitIntWith(int weight) const {
+        int magnitude = weightMagnitude(weight) > max_abs_weight ? weightMagnitude(weight) : max_abs_weight;
+        return (long long)magnitude * vertices < INT_MAX;
+    }
+    int getWeightWidth() const { return narrowestWeightWidth(max_abs_weight); }
+    
+    // Waga krawedzi (0 - brak): z macierzy, gdy jest zbudowana, inaczej z wiersza listy
+    // (brak krawedzi rozstrzyga od razu mapa bitowa, jesli jest zbudowana)
+    int getEdgeWeight(int start, int end) const;
+    
+    // Wpis listy sasiedztwa nr entry w kolejnosci wierszy, 0 <= entry < getListEntryCount()
+    // (graf nieskierowany: kazda krawedz dwa razy). Losowy wpis to losowa krawedz bez budowy
+    // listy krawedzi - O(V) zamiast O(E) po kazdej zmianie grafu.
+    Edge getListEntry(int entry) const;
+    int getListEntryCount() const { return directed ? edges_count : 2 * edges_count; }
+    
+    int** getMatrix() { buildMatrix(); return adjacency_matrix; }
+    int** getList() { return adjacency_list; }
+    int* getListSizes() { return list_sizes; }
+    Edge* getEdges() { buildEdgeList(); return edge_list; }
+    const AdjacencyBitmap& getAdjacencyBitmap() { buildAdjacencyBitmap(); return adjacency_bits; }
+    const int* getOriginalId() const { return original_id; }
+    const int* getCurrentId() const { return current_id; }
+    
+    // Dostep do CSR - wymaga wczesniejszego buildCSR() (wstecz: buildReverseCSR())
+    const int* getCsrOffsets() const { return csr_offsets; }
+    const int* getCsrTargets() const { return csr_targets; }
+    const int* getCsrWeights() const { return csr_weights; }
+    const int* getReverseCsrOffsets() const { return rcsr_offsets; }
+    const int* getReverseCsrTargets() const { return rcsr_targets; }
+    const int* getReverseCsrWeights() const { return rcsr_weights; }
+    
+    // Dostep do zwartych macierzy - wymaga wczesniejszego build*(), W zgodne z getWeightWidth()
+    template<typename W> const W* getNarrowMatrix() const { return narrow_matrix.data<W>(); }
+    template<typename W> const W* getTriangularMatrix() const { return triangular_matrix.data<W>(); }
+};
+
+#endif
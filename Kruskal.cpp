@@ -1,17 +1,8 @@
 #include <iostream>
-#include <fstream>
-#include <string>
-#include <cstdlib>
-#include <ctime>
 #include <chrono>
 #include <iomanip>
-
-struct Edge {
-    int start, end, weight;
-    
-    Edge() : start(0), end(0), weight(0) {}
-    Edge(int s, int e, int w) : start(s), end(e), weight(w) {}
-};
+#include "Algorithms.h"
+#include "DynamicMST.h"
 
 // Implementacja kopca dla sortowania krawędzi (heap sort)
 class EdgeHeap {
@@ -28,7 +19,7 @@ private:
             largest = left;
         if(right < n && heap[right].weight > heap[largest].weight)
             largest = right;
-            
+        
         if(largest != i) {
             Edge temp = heap[i];
             heap[i] = heap[largest];
@@ -56,598 +47,190 @@ public:
     }
 };
 
-class Graph {
-private:
-    int vertices;
-    int edges_count;
-    int** adjacency_matrix;
-    Edge* edge_list;
-    int** adjacency_list;
-    int* list_sizes;
-    
-    void reallocateMemory(int new_vertices) {
-        if(adjacency_matrix) {
-            for(int i = 0; i < vertices; i++) {
-                delete[] adjacency_matrix[i];
-                delete[] adjacency_list[i];
+// Union-Find z kompresja sciezki i union by rank (zgodnie z wymaganiami)
+static int find(int parent[], int i) {
+    if(parent[i] != i) {
+        parent[i] = find(parent, parent[i]); // Kompresja sciezki
+    }
+    return parent[i];
+}
+
+static void unionSets(int parent[], int rank[], int x, int y) {
+    int rootX = find(parent, x);
+    int rootY = find(parent, y);
+    
+    // Union by rank
+    if(rank[rootX] < rank[rootY]) {
+        parent[rootX] = rootY;
+    } else if(rank[rootX] > rank[rootY]) {
+        parent[rootY] = rootX;
+    } else {
+        parent[rootY] = rootX;
+        rank[rootX]++;
+    }
+}
+
+// Krawedzie z gornego trojkata zwartej macierzy wag typu W; pola niezerowe wskazuje mapa
+// bitowa (w pierwszym slowie wiersza i maskowane kolumny <= i)
+template<typename W>
+static int collectMatrixEdges(const W* adjacency_matrix, const AdjacencyBitmap& bits, int vertices, Edge* edges) {
+    int edge_count = 0;
+    for(int i = 0; i < vertices - 1; i++) {
+        const W* row = adjacency_matrix + (size_t)i * vertices;
+        const uint64_t* row_bits = bits.row(i);
+        int first = (i + 1) >> 6;
+        for(int word = first; word < bits.rowWords(); word++) {
+            uint64_t mask = row_bits[word];
+            if(word == first) mask &= ~0ULL << ((i + 1) & 63);
+            for(; mask; mask &= mask - 1) {
+                int j = word * 64 + lowestBit(mask);
+                edges[edge_count++] = Edge(i, j, row[j]);
+            }
+        }
+    }
+    return edge_count;
+}
+
+// Krawedzie z upakowanego gornego trojkata - wiersze lezace jeden za drugim
+template<typename W>
+static int collectTriangleEdges(const W* packed, int vertices, Edge* edges) {
+    int edge_count = 0;
+    for(int i = 0; i < vertices; i++) {
+        const W* row = packed + triangularRowOffset(i, vertices);
+        for(int j = i + 1; j < vertices; j++) {
+            if(row[j - i - 1] != 0) {
+                edges[edge_count++] = Edge(i, j, row[j - i - 1]);
             }
-            delete[] adjacency_matrix;
-            delete[] adjacency_list;
-            delete[] list_sizes;
-            delete[] edge_list;
         }
-        
-        vertices = new_vertices;
-        adjacency_matrix = new int*[vertices];
+    }
+    return edge_count;
+}
+
+// Algorytm Kruskala z heap sort: krawedzie zbierane z macierzy (gorny trojkat)
+// lub z list sasiedztwa. Zwraca liczbe krawedzi drzewa zapisanych w result.
+static int kruskal(Graph& graph, int representation, Edge* result) {
+    int vertices = graph.getVertices();
+    int** adjacency_list = graph.getList();
+    int* list_sizes = graph.getListSizes();
+    
+    Edge* edges = new Edge[graph.getEdgeCount()];
+    int edge_count = 0;
+    
+    if(representation == REP_MATRIX) {
+        // Budowanie listy krawedzi ze zwartej macierzy w typie wag grafu
+        switch(graph.getWeightWidth()) {
+            case WEIGHT_INT8: edge_count = collectMatrixEdges(graph.getNarrowMatrix<int8_t>(), graph.getAdjacencyBitmap(), vertices, edges); break;
+            case WEIGHT_INT16: edge_count = collectMatrixEdges(graph.getNarrowMatrix<int16_t>(), graph.getAdjacencyBitmap(), vertices, edges); break;
+            default: edge_count = collectMatrixEdges(graph.getNarrowMatrix<int32_t>(), graph.getAdjacencyBitmap(), vertices, edges); break;
+        }
+    } else if(representation == REP_TRIANGULAR) {
+        switch(graph.getWeightWidth()) {
+            case WEIGHT_INT8: edge_count = collectTriangleEdges(graph.getTriangularMatrix<int8_t>(), vertices, edges); break;
+            case WEIGHT_INT16: edge_count = collectTriangleEdges(graph.getTriangularMatrix<int16_t>(), vertices, edges); break;
+            default: edge_count = collectTriangleEdges(graph.getTriangularMatrix<int32_t>(), vertices, edges); break;
+        }
+    } else {
+        // Budowanie listy krawedzi z list sasiedztwa
         for(int i = 0; i < vertices; i++) {
-            adjacency_matrix[i] = new int[vertices];
-            for(int j = 0; j < vertices; j++) {
-                adjacency_matrix[i][j] = 0;
+            for(int j = 0; j < list_sizes[i]; j++) {
+                int neighbor = adjacency_list[i][j * 2];
+                if(i < neighbor) { // Unikanie duplikatow w grafie nieskierowanym
+                    edges[edge_count++] = Edge(i, neighbor, adjacency_list[i][j * 2 + 1]);
+                }
             }
         }
-        
-        adjacency_list = new int*[vertices];
-        list_sizes = new int[vertices];
-        for(int i = 0; i < vertices; i++) {
-            adjacency_list[i] = new int[vertices];
-            list_sizes[i] = 0;
-        }
-        
-        edge_list = new Edge[vertices * vertices];
-        edges_count = 0;
     }
     
-public:
-    Graph(int v) : vertices(v), edges_count(0), adjacency_matrix(nullptr), 
-                   edge_list(nullptr), adjacency_list(nullptr), list_sizes(nullptr) {
-        reallocateMemory(v);
-    }
+    // Sortowanie krawedzi za pomoca heap sort (O(E log E))
+    EdgeHeap edgeHeap(edges, edge_count);
+    edgeHeap.heapSort();
     
-    ~Graph() {
-        if(adjacency_matrix) {
-            for(int i = 0; i < vertices; i++) {
-                delete[] adjacency_matrix[i];
-                delete[] adjacency_list[i];
-            }
-            delete[] adjacency_matrix;
-            delete[] adjacency_list;
-            delete[] list_sizes;
-            delete[] edge_list;
-        }
-    }
+    // Struktury Union-Find
+    int* parent = new int[vertices];
+    int* rank = new int[vertices];
     
-    void loadFromFile(const std::string& filename) {
-        std::ifstream file(filename);
-        if(!file.is_open()) {
-            std::cout << "Blad: Nie mozna otworzyc pliku " << filename << std::endl;
-            return;
-        }
-        
-        int file_edges, file_vertices;
-        file >> file_edges >> file_vertices;
-        
-        reallocateMemory(file_vertices);
-        
-        for(int i = 0; i < file_edges; i++) {
-            int start, end, weight;
-            file >> start >> end >> weight;
-            addEdge(start, end, weight);
-            edge_list[i] = Edge(start, end, weight);
-        }
-        edges_count = file_edges;
-        
-        file.close();
-        
-        std::cout << "Graf wczytany z pliku. Reprezentacje:" << std::endl;
-        displayMatrix();
-        displayList();
+    for(int i = 0; i < vertices; i++) {
+        parent[i] = i;
+        rank[i] = 0;
     }
     
-    void generateRandom(int v, int density) {
-        reallocateMemory(v);
-        
-        // Generowanie drzewa rozpinajacego dla spojnosci (zgodnie z wymaganiami)
-        for(int i = 1; i < vertices; i++) {
-            int parent = rand() % i;
-            int weight = rand() % 100 + 1;
-            addEdge(parent, i, weight);
-            edge_list[edges_count++] = Edge(parent, i, weight);
-        }
-        
-        int max_edges = (vertices * (vertices - 1)) / 2;
-        int target_edges = (max_edges * density) / 100;
-        
-        // Dodawanie pozostalych krawedzi
-        while(edges_count < target_edges) {
-            int start = rand() % vertices;
-            int end = rand() % vertices;
-            
-            if(start != end && adjacency_matrix[start][end] == 0) {
-                int weight = rand() % 100 + 1;
-                addEdge(start, end, weight);
-                edge_list[edges_count++] = Edge(start, end, weight);
-            }
-        }
-        
-        std::cout << "Graf wygenerowany losowo (" << vertices << " wierzcholkow, " 
-                  << density << "% gestosci, " << edges_count << " krawedzi)" << std::endl;
-        displayMatrix();
-        displayList();
-    }
+    int result_count = 0;
     
-    void generateRandomForTesting(int v, int density) {
-        reallocateMemory(v);
-        
-        for(int i = 1; i < vertices; i++) {
-            int parent = rand() % i;
-            int weight = rand() % 100 + 1;
-            addEdge(parent, i, weight);
-            edge_list[edges_count++] = Edge(parent, i, weight);
-        }
+    // Glowna petla algorytmu Kruskala
+    for(int i = 0; i < edge_count && result_count < vertices - 1; i++) {
+        int x = find(parent, edges[i].start);
+        int y = find(parent, edges[i].end);
         
-        int max_edges = (vertices * (vertices - 1)) / 2;
-        int target_edges = (max_edges * density) / 100;
-        
-        while(edges_count < target_edges) {
-            int start = rand() % vertices;
-            int end = rand() % vertices;
-            
-            if(start != end && adjacency_matrix[start][end] == 0) {
-                int weight = rand() % 100 + 1;
-                addEdge(start, end, weight);
-                edge_list[edges_count++] = Edge(start, end, weight);
-            }
+        if(x != y) {
+            result[result_count++] = edges[i];
+            unionSets(parent, rank, x, y);
         }
     }
     
-    void addEdge(int start, int end, int weight) {
-        // Graf nieskierowany dla MST (zgodnie z wymaganiami)
-        adjacency_matrix[start][end] = weight;
-        adjacency_matrix[end][start] = weight;
-        
-        adjacency_list[start][list_sizes[start]++] = end;
-        adjacency_list[end][list_sizes[end]++] = start;
-    }
+    delete[] edges;
+    delete[] parent;
+    delete[] rank;
     
-    void displayMatrix() {
-        if(vertices > 20) {
-            std::cout << "\nGraf zbyt duzy do wyswietlenia macierzy (>20 wierzcholkow)" << std::endl;
-            return;
-        }
-        
-        std::cout << "\nReprezentacja macierzowa:" << std::endl;
-        std::cout << "   ";
-        for(int i = 0; i < vertices; i++) {
-            std::cout << i << "  ";
-        }
-        std::cout << std::endl;
-        
-        for(int i = 0; i < vertices; i++) {
-            std::cout << i << ": ";
-            for(int j = 0; j < vertices; j++) {
-                std::cout << adjacency_matrix[i][j] << "  ";
-            }
-            std::cout << std::endl;
-        }
-    }
+    return result_count;
+}
+
+static double kruskalTimed(Graph& graph, int representation, Edge* result, int& result_count) {
+    // Zwarta macierz jest reprezentacja grafu - budowana poza pomiarem, jak macierz int
+    if(representation == REP_MATRIX) graph.buildNarrowMatrix();
+    if(representation == REP_TRIANGULAR) graph.buildTriangularMatrix();
+    auto start_time = std::chrono::high_resolution_clock::now();
     
-    void displayList() {
-        if(vertices > 20) {
-            std::cout << "\nGraf zbyt duzy do wyswietlenia listy (>20 wierzcholkow)" << std::endl;
-            return;
-        }
-        
-        std::cout << "\nReprezentacja listowa:" << std::endl;
-        for(int i = 0; i < vertices; i++) {
-            std::cout << i << ": ";
-            for(int j = 0; j < list_sizes[i]; j++) {
-                std::cout << adjacency_list[i][j] << " ";
-            }
-            std::cout << std::endl;
-        }
-    }
+    result_count = kruskal(graph, representation, result);
     
-    // Union-Find z kompresja sciezki i union by rank (zgodnie z wymaganiami)
-    int find(int parent[], int i) {
-        if(parent[i] != i) {
-            parent[i] = find(parent, parent[i]); // Kompresja sciezki
-        }
-        return parent[i];
-    }
+    auto end_time = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(end_time - start_time);
+    return duration.count() / 1000000000.0;
+}
+
+static void kruskalRun(Graph& graph, int representation) {
+    std::cout << "\nAlgorytm Kruskala - reprezentacja " << representationName(representation) << ":" << std::endl;
     
-    void unionSets(int parent[], int rank[], int x, int y) {
-        int rootX = find(parent, x);
-        int rootY = find(parent, y);
-        
-        // Union by rank
-        if(rank[rootX] < rank[rootY]) {
-            parent[rootX] = rootY;
-        } else if(rank[rootX] > rank[rootY]) {
-            parent[rootY] = rootX;
-        } else {
-            parent[rootY] = rootX;
-            rank[rootX]++;
-        }
-    }
+    Edge* result = new Edge[graph.getVertices()];
+    int result_count;
+    double seconds = kruskalTimed(graph, representation, result, result_count);
     
-    // Algorytm Kruskala dla reprezentacji macierzowej z heap sort
-    void kruskalMatrix() {
-        std::cout << "\nAlgorytm Kruskala - reprezentacja macierzowa:" << std::endl;
-        
-        auto start_time = std::chrono::high_resolution_clock::now();
-        
-        Edge* matrix_edges = new Edge[vertices * vertices];
-        int edge_count = 0;
-        
-        // Budowanie listy krawedzi z macierzy sasiedztwa
-        for(int i = 0; i < vertices; i++) {
-            for(int j = i + 1; j < vertices; j++) {
-                if(adjacency_matrix[i][j] != 0) {
-                    matrix_edges[edge_count++] = Edge(i, j, adjacency_matrix[i][j]);
-                }
-            }
-        }
-        
-        // Sortowanie krawedzi za pomoca heap sort (O(E log E))
-        EdgeHeap edgeHeap(matrix_edges, edge_count);
-        edgeHeap.heapSort();
-        
-        // Struktury Union-Find
-        int* parent = new int[vertices];
-        int* rank = new int[vertices];
-        
-        for(int i = 0; i < vertices; i++) {
-            parent[i] = i;
-            rank[i] = 0;
-        }
-        
-        Edge* result = new Edge[vertices - 1];
-        int result_count = 0;
-        int total_weight = 0;
-        
-        // Glowna petla algorytmu Kruskala
-        for(int i = 0; i < edge_count && result_count < vertices - 1; i++) {
-            int x = find(parent, matrix_edges[i].start);
-            int y = find(parent, matrix_edges[i].end);
-            
-            if(x != y) {
-                result[result_count++] = matrix_edges[i];
-                total_weight += matrix_edges[i].weight;
-                unionSets(parent, rank, x, y);
-            }
-        }
-        
-        auto end_time = std::chrono::high_resolution_clock::now();
-        auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(end_time - start_time);
-        double seconds = duration.count() / 1000000000.0;
-        
-        // Wyswietlenie wynikow zgodnie z wymaganiami
-        std::cout << "Krawedzie minimalnego drzewa rozpinajacego:" << std::endl;
-        for(int i = 0; i < result_count; i++) {
-            std::cout << result[i].start << " - " << result[i].end 
-                      << " (waga: " << result[i].weight << ")" << std::endl;
-        }
-        std::cout << "Sumaryczna waga MST: " << total_weight << std::endl;
-        std::cout << "Czas wykonania (reprezentacja macierzowa): " << std::fixed << std::setprecision(6) << seconds << " sekund" << std::endl;
-        
-        delete[] matrix_edges;
-        delete[] parent;
-        delete[] rank;
-        delete[] result;
-    }
+    printSpanningTree(graph, result, result_count);
+    std::cout << "Czas wykonania (reprezentacja " << representationName(representation) << "): "
+              << std::fixed << std::setprecision(6) << seconds << " sekund" << std::endl;
     
-    // Algorytm Kruskala dla reprezentacji listowej z heap sort
-    void kruskalList() {
-        std::cout << "\nAlgorytm Kruskala - reprezentacja listowa:" << std::endl;
-        
-        auto start_time = std::chrono::high_resolution_clock::now();
-        
-        Edge* list_edges = new Edge[vertices * vertices];
-        int edge_count = 0;
-        
-        // Budowanie listy krawedzi z list sasiedztwa
-        for(int i = 0; i < vertices; i++) {
-            for(int j = 0; j < list_sizes[i]; j++) {
-                int neighbor = adjacency_list[i][j];
-                if(i < neighbor) { // Unikanie duplikatow w grafie nieskierowanym
-                    int weight = adjacency_matrix[i][neighbor];
-                    list_edges[edge_count++] = Edge(i, neighbor, weight);
-                }
-            }
-        }
-        
-        // Sortowanie krawedzi za pomoca heap sort (O(E log E))
-        EdgeHeap edgeHeap(list_edges, edge_count);
-        edgeHeap.heapSort();
-        
-        // Struktury Union-Find
-        int* parent = new int[vertices];
-        int* rank = new int[vertices];
-        
-        for(int i = 0; i < vertices; i++) {
-            parent[i] = i;
-            rank[i] = 0;
-        }
-        
-        Edge* result = new Edge[vertices - 1];
-        int result_count = 0;
-        int total_weight = 0;
-        
-        // Glowna petla algorytmu Kruskala
-        for(int i = 0; i < edge_count && result_count < vertices - 1; i++) {
-            int x = find(parent, list_edges[i].start);
-            int y = find(parent, list_edges[i].end);
-            
-            if(x != y) {
-                result[result_count++] = list_edges[i];
-                total_weight += list_edges[i].weight;
-                unionSets(parent, rank, x, y);
-            }
-        }
-        
-        auto end_time = std::chrono::high_resolution_clock::now();
-        auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(end_time - start_time);
-        double seconds = duration.count() / 1000000000.0;
-        
-        // Wyswietlenie wynikow zgodnie z wymaganiami
-        std::cout << "Krawedzie minimalnego drzewa rozpinajacego:" << std::endl;
+    delete[] result;
+}
+
+static double kruskalExecute(Graph& graph, int representation, AlgorithmOutput* output) {
+    Edge* result = new Edge[graph.getVertices()];
+    int result_count;
+    double seconds = kruskalTimed(graph, representation, result, result_count);
+    
+    // Waga drzewa dla trybu weryfikacji (poza mierzonym czasem)
+    if(output) {
+        output->weight = 0;
+        output->tree_size = 0;
         for(int i = 0; i < result_count; i++) {
-            std::cout << result[i].start << " - " << result[i].end 
-                      << " (waga: " << result[i].weight << ")" << std::endl;
-        }
-        std::cout << "Sumaryczna waga MST: " << total_weight << std::endl;
-        std::cout << "Czas wykonania (reprezentacja listowa): " << std::fixed << std::setprecision(6) << seconds << " sekund" << std::endl;
-        
-        delete[] list_edges;
-        delete[] parent;
-        delete[] rank;
-        delete[] result;
-    }
-    
-    // Funkcje pomocnicze dla testow wydajnosci
-    double executeKruskalMatrix() {
-        auto start_time = std::chrono::high_resolution_clock::now();
-        
-        Edge* matrix_edges = new Edge[vertices * vertices];
-        int edge_count = 0;
-        
-        for(int i = 0; i < vertices; i++) {
-            for(int j = i + 1; j < vertices; j++) {
-                if(adjacency_matrix[i][j] != 0) {
-                    matrix_edges[edge_count++] = Edge(i, j, adjacency_matrix[i][j]);
-                }
-            }
-        }
-        
-        EdgeHeap edgeHeap(matrix_edges, edge_count);
-        edgeHeap.heapSort();
-        
-        int* parent = new int[vertices];
-        int* rank = new int[vertices];
-        
-        for(int i = 0; i < vertices; i++) {
-            parent[i] = i;
-            rank[i] = 0;
-        }
-        
-        Edge* result = new Edge[vertices - 1];
-        int result_count = 0;
-        
-        for(int i = 0; i < edge_count && result_count < vertices - 1; i++) {
-            int x = find(parent, matrix_edges[i].start);
-            int y = find(parent, matrix_edges[i].end);
-            
-            if(x != y) {
-                result[result_count++] = matrix_edges[i];
-                unionSets(parent, rank, x, y);
-            }
-        }
-        
-        auto end_time = std::chrono::high_resolution_clock::now();
-        auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(end_time - start_time);
-        double seconds = duration.count() / 1000000000.0;
-        
-        delete[] matrix_edges;
-        delete[] parent;
-        delete[] rank;
-        delete[] result;
-        
-        return seconds;
-    }
-    
-    double executeKruskalList() {
-        auto start_time = std::chrono::high_resolution_clock::now();
-        
-        Edge* list_edges = new Edge[vertices * vertices];
-        int edge_count = 0;
-        
-        for(int i = 0; i < vertices; i++) {
-            for(int j = 0; j < list_sizes[i]; j++) {
-                int neighbor = adjacency_list[i][j];
-                if(i < neighbor) {
-                    int weight = adjacency_matrix[i][neighbor];
-                    list_edges[edge_count++] = Edge(i, neighbor, weight);
-                }
-            }
-        }
-        
-        EdgeHeap edgeHeap(list_edges, edge_count);
-        edgeHeap.heapSort();
-        
-        int* parent = new int[vertices];
-        int* rank = new int[vertices];
-        
-        for(int i = 0; i < vertices; i++) {
-            parent[i] = i;
-            rank[i] = 0;
-        }
-        
-        Edge* result = new Edge[vertices - 1];
-        int result_count = 0;
-        
-        for(int i = 0; i < edge_count && result_count < vertices - 1; i++) {
-            int x = find(parent, list_edges[i].start);
-            int y = find(parent, list_edges[i].end);
-            
-            if(x != y) {
-                result[result_count++] = list_edges[i];
-                unionSets(parent, rank, x, y);
-            }
+            output->weight += result[i].weight;
+            if(output->tree) output->tree[output->tree_size++] = result[i];
         }
-        
-        auto end_time = std::chrono::high_resolution_clock::now();
-        auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(end_time - start_time);
-        double seconds = duration.count() / 1000000000.0;
-        
-        delete[] list_edges;
-        delete[] parent;
-        delete[] rank;
-        delete[] result;
-        
-        return seconds;
     }
     
-    // Testy wydajnosci zgodnie z wymaganiami projektu
-    void performPerformanceTests() {
-        std::cout << "\n=== TESTY WYDAJNOSCI ALGORYTMU KRUSKALA ===" << std::endl;
-        std::cout << "Zgodnie z wymaganiami projektu:" << std::endl;
-        std::cout << "- 7 rozmiarow grafow" << std::endl;
-        std::cout << "- 3 gestosci: 20%, 60%, 99%" << std::endl;
-        std::cout << "- 50 instancji dla kazdego zestawu" << std::endl;
-        std::cout << "- Wyniki usrednione\n" << std::endl;
-        
-        int test_sizes[] = {500,1000, 2000, 3000,4000,5000,6000};
-        int densities[] = {20, 60, 99};
-        int num_tests = 3;
-        
-        for(int size_idx = 0; size_idx < 7; size_idx++) {
-            int v = test_sizes[size_idx];
-            
-            for(int dens_idx = 0; dens_idx < 3; dens_idx++) {
-                int density = densities[dens_idx];
-                
-                double total_time_matrix = 0.0;
-                double total_time_list = 0.0;
-                
-                std::cout << "Testowanie " << v << " wierzcholkow, gestosc " << density << "%... ";
-                std::cout.flush();
-                
-                for(int test = 0; test < num_tests; test++) {
-                    generateRandomForTesting(v, density);
-                    
-                    double time_matrix = executeKruskalMatrix();
-                    total_time_matrix += time_matrix;
-                    
-                    double time_list = executeKruskalList();
-                    total_time_list += time_list;
-                }
-                
-                double avg_time_matrix = total_time_matrix / num_tests;
-                double avg_time_list = total_time_list / num_tests;
-                
-                std::cout << "GOTOWE" << std::endl;
-                
-                std::cout << "ilosc wierzcholkow = " << v << " gestosc = " << density << " reprezentacja = macierzowa" << std::endl;
-                std::cout << "czas w sekundach = " << std::fixed << std::setprecision(6) << avg_time_matrix << std::endl;
-                std::cout << std::endl;
-                
-                std::cout << "ilosc wierzcholkow = " << v << " gestosc = " << density << " reprezentacja = listowa" << std::endl;
-                std::cout << "czas w sekundach = " << std::fixed << std::setprecision(6) << avg_time_list << std::endl;
-                std::cout << std::endl;
-            }
-        }
-        
-        std::cout << "=== KONIEC TESTOW WYDAJNOSCI ===" << std::endl;
-    }
-};
+    delete[] result;
+    return seconds;
+}
 
-int main() {
-    srand(time(nullptr));
-    Graph* graph = nullptr;
-    int choice;
-    
-    std::cout << "=== ALGORYTM KRUSKALA - MINIMALNE DRZEWO ROZPINAJACE ===" << std::endl;
-    
-    do {
-        std::cout << "\n--- MENU ---" << std::endl;
-        std::cout << "1. Wczytaj z pliku" << std::endl;
-        std::cout << "2. Wygeneruj graf losowo" << std::endl;
-        std::cout << "3. Wyswietl listowo i macierzowo" << std::endl;
-        std::cout << "4. Algorytm Kruskala - macierzowo" << std::endl;
-        std::cout << "5. Algorytm Kruskala - listowo" << std::endl;
-        std::cout << "6. Testy wydajnosci (zgodnie z wymaganiami)" << std::endl;
-        std::cout << "0. Wyjscie" << std::endl;
-        std::cout << "Wybierz opcje: ";
-        std::cin >> choice;
-        
-        switch(choice) {
-            case 1: {
-                std::string filename;
-                std::cout << "Podaj nazwe pliku: ";
-                std::cin >> filename;
-                
-                if(graph) delete graph;
-                graph = new Graph(10);
-                graph->loadFromFile(filename);
-                break;
-            }
-            case 2: {
-                int vertices, density;
-                std::cout << "Podaj liczbe wierzcholkow: ";
-                std::cin >> vertices;
-                std::cout << "Podaj gestosc grafu (w %): ";
-                std::cin >> density;
-                
-                if(graph) delete graph;
-                graph = new Graph(vertices);
-                graph->generateRandom(vertices, density);
-                break;
-            }
-            case 3: {
-                if(graph) {
-                    graph->displayMatrix();
-                    graph->displayList();
-                } else {
-                    std::cout << "Brak grafu! Wczytaj lub wygeneruj graf." << std::endl;
-                }
-                break;
-            }
-            case 4: {
-                if(graph) {
-                    graph->kruskalMatrix();
-                } else {
-                    std::cout << "Brak grafu! Wczytaj lub wygeneruj graf." << std::endl;
-                }
-                break;
-            }
-            case 5: {
-                if(graph) {
-                    graph->kruskalList();
-                } else {
-                    std::cout << "Brak grafu! Wczytaj lub wygeneruj graf." << std::endl;
-                }
-                break;
-            }
-            case 6: {
-                std::cout << "Uwaga: Testy wydajnosci moga potrwac kilka minut..." << std::endl;
-                std::cout << "Czy kontynuowac? (t/n): ";
-                char confirm;
-                std::cin >> confirm;
-                if(confirm == 't' || confirm == 'T') {
-                    if(graph) delete graph;
-                    graph = new Graph(10);
-                    graph->performPerformanceTests();
-                }
-                break;
-            }
-            case 0:
-                std::cout << "Koniec programu." << std::endl;
-                break;
-            default:
-                std::cout << "Nieprawidlowa opcja!" << std::endl;
-        }
-    } while(choice != 0);
-    
-    if(graph) delete graph;
-    return 0;
+// Opcje dodatkowe: dynamiczne MST zainicjowane drzewem z tego algorytmu
+static void kruskalMenu(Graph& graph) {
+    dynamicMSTMenu(graph, *findAlgorithm("kruskal"));
 }
+
+static const int kruskal_test_sizes[] = {500, 1000, 2000, 3000, 4000, 5000, 6000};
+
+static const AlgorithmInfo kruskal_info = {
+    "kruskal", "Algorytm Kruskala (MST)", GRAPH_UNDIRECTED, false, REP_MASK_UNDIRECTED,
+    kruskal_test_sizes, 7, 3,
+    kruskalRun, kruskalExecute, nullptr, kruskalMenu
+};
+
+static AlgorithmRegistrar kruskal_registrar(kruskal_info);
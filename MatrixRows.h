@@ -0,0 +1,53 @@
+#ifndef MATRIXROWS_H
+#define MATRIXROWS_H
+
+#include "Graph.h"
+
+// Wiersze zwartych macierzy wag dla algorytmow przegladajacych pelne wiersze (Prim):
+// row(u) zwraca V wag wiersza u (0 - brak krawedzi)
+
+// Pelna macierz V*V - wiersz jest fragmentem tablicy
+template<typename W>
+class FullMatrixRows {
+private:
+    const W* matrix;
+    int vertices;
+    
+public:
+    FullMatrixRows(const W* m, int v) : matrix(m), vertices(v) {}
+    
+    const W* row(int u) { return matrix + (size_t)u * vertices; }
+};
+
+// Gorny trojkat grafu nieskierowanego - wiersz skladany w buforze: dla v < u kolumna u
+// z wierszy v (odstep miedzy kolejnymi polami maleje o 1), dla v > u ciagly wiersz u
+template<typename W>
+class TriangularMatrixRows {
+private:
+    const W* packed;
+    int vertices;
+    W* buffer;
+    
+public:
+    TriangularMatrixRows(const W* p, int v) : packed(p), vertices(v) {
+        buffer = new W[v];
+    }
+    
+    ~TriangularMatrixRows() {
+        delete[] buffer;
+    }
+    
+    const W* row(int u) {
+        size_t index = (size_t)u - 1; // pole (0, u)
+        for(int v = 0; v < u; v++) {
+            buffer[v] = packed[index];
+            index += vertices - v - 2;
+        }
+        buffer[u] = 0;
+        const W* upper = packed + triangularRowOffset(u, vertices);
+        for(int v = u + 1; v < vertices; v++) buffer[v] = upper[v - u - 1];
+        return buffer;
+    }
+};
+
+#endif
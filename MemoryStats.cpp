@@ -0,0 +1,54 @@
+#include "MemoryStats.h"
+#include <cstdint>
+
+// Operatory nie moga byc rozwijane w miejscu wywolania - kompilator traktuje ich
+// wynik jako nowy blok i myli naglowek z odczytem poza tablica
+#if defined(__GNUC__)
+#define MEMORY_NOINLINE __attribute__((noinline))
+#else
+#define MEMORY_NOINLINE
+#endif
+
+MEMORY_NOINLINE void* operator new(std::size_t size) {
+    if(size > SIZE_MAX - MEMORY_HEADER) throw std::bad_alloc();
+    void* block = std::malloc(size + MEMORY_HEADER);
+    if(!block) throw std::bad_alloc();
+    *static_cast<std::size_t*>(block) = size;
+    memoryAllocated(size);
+    return static_cast<char*>(block) + MEMORY_HEADER;
+}
+
+void* operator new[](std::size_t size) {
+    return operator new(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    try {
+        return operator new(size);
+    } catch(...) {
+        return nullptr;
+    }
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+    return operator new(size, std::nothrow);
+}
+
+MEMORY_NOINLINE void operator delete(void* ptr) noexcept {
+    if(!ptr) return;
+    char* block = static_cast<char*>(ptr) - MEMORY_HEADER;
+    memoryReleased(*reinterpret_cast<std::size_t*>(block));
+    std::free(block);
+}
+
+void operator delete[](void* ptr) noexcept {
+    operator delete(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+    operator delete(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept {
+    operator delete(ptr);
+}
@@ -0,0 +1,107 @@
+#ifndef MEMORYSTATS_H
+#define MEMORYSTATS_H
+
+// Rozliczanie pamieci: zastapione globalne operator new/delete zliczaja przydzielone
+// bajty, liczbe alokacji oraz szczyt pamieci zajetej. Wszystkie bufory grafu
+// (macierz, lista, krawedzie) i algorytmow sa alokowane przez new[], wiec trafiaja do licznikow.
+// Definicje operatorow znajduja sie w MemoryStats.cpp.
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include <iostream>
+#include <iomanip>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
+
+inline std::atomic<long long> memory_total_bytes(0);  // suma przydzielonych bajtow
+inline std::atomic<long long> memory_total_count(0);  // liczba alokacji
+inline std::atomic<long long> memory_live_bytes(0);   // aktualnie zajete bajty
+inline std::atomic<long long> memory_peak_bytes(0);   // szczyt zajetych bajtow
+
+// Naglowek przed kazdym blokiem przechowuje jego rozmiar (wyrownanie max_align_t)
+const std::size_t MEMORY_HEADER = alignof(std::max_align_t);
+
+inline void memoryAllocated(std::size_t size) {
+    memory_total_bytes.fetch_add((long long)size, std::memory_order_relaxed);
+    memory_total_count.fetch_add(1, std::memory_order_relaxed);
+    long long live = memory_live_bytes.fetch_add((long long)size, std::memory_order_relaxed) + (long long)size;
+    long long peak = memory_peak_bytes.load(std::memory_order_relaxed);
+    while(live > peak && !memory_peak_bytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+    }
+}
+
+inline void memoryReleased(std::size_t size) {
+    memory_live_bytes.fetch_sub((long long)size, std::memory_order_relaxed);
+}
+
+// Szczytowa pamiec rezydentna procesu w KB (0 gdy system jej nie udostepnia)
+inline long long peakResidentKB() {
+#if defined(__APPLE__)
+    struct rusage usage;
+    if(getrusage(RUSAGE_SELF, &usage) != 0) return 0;
+    return usage.ru_maxrss / 1024; // macOS podaje bajty
+#elif defined(__unix__)
+    struct rusage usage;
+    if(getrusage(RUSAGE_SELF, &usage) != 0) return 0;
+    return usage.ru_maxrss;
+#else
+    return 0;
+#endif
+}
+
+// Zuzycie pamieci jednego etapu (budowa grafu / przebieg algorytmu) lub suma wielu etapow
+struct MemoryUsage {
+    long long bytes;       // przydzielone bajty
+    long long allocations; // liczba alokacji
+    long long peak;        // szczyt ponad stan poczatkowy (dla sumy - maksimum)
+    long long heap_peak;   // szczyt calej zajetej pamieci sterty (dla sumy - maksimum)
+    
+    MemoryUsage() : bytes(0), allocations(0), peak(0), heap_peak(0) {}
+    
+    void add(const MemoryUsage& other) {
+        bytes += other.bytes;
+        allocations += other.allocations;
+        if(other.peak > peak) peak = other.peak;
+        if(other.heap_peak > heap_peak) heap_peak = other.heap_peak;
+    }
+};
+
+// Pomiar pamieci pomiedzy start() i stop()
+class MemoryScope {
+private:
+    long long start_bytes;
+    long long start_count;
+    long long start_live;
+    
+public:
+    MemoryScope() : start_bytes(0), start_count(0), start_live(0) {}
+    
+    void start() {
+        start_bytes = memory_total_bytes.load();
+        start_count = memory_total_count.load();
+        start_live = memory_live_bytes.load();
+        memory_peak_bytes.store(start_live); // szczyt liczony od biezacego stanu
+    }
+    
+    MemoryUsage stop() {
+        MemoryUsage usage;
+        usage.bytes = memory_total_bytes.load() - start_bytes;
+        usage.allocations = memory_total_count.load() - start_count;
+        usage.heap_peak = memory_peak_bytes.load();
+        usage.peak = usage.heap_peak - start_live;
+        return usage;
+    }
+};
+
+inline void printMemoryUsage(const char* label, const MemoryUsage& total, int runs) {
+    std::cout << label << ": przydzielono = " << std::fixed << std::setprecision(1)
+              << total.bytes / runs / 1024.0 << " KB, szczyt = " << total.peak / 1024.0
+              << " KB, szczyt sterty = " << total.heap_peak / 1048576.0
+              << " MB, alokacji = " << total.allocations / runs << std::endl;
+}
+
+#endif
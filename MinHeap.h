@@ -0,0 +1,121 @@
+#ifndef MINHEAP_H
+#define MINHEAP_H
+
+#include <climits>
+
+// Implementacja kopca binarnego (min-heap) zgodnie z wymaganiami projektu
+class MinHeap {
+private:
+    struct HeapNode {
+        int vertex;
+        int key;
+        HeapNode() : vertex(-1), key(INT_MAX) {}
+        HeapNode(int v, int k) : vertex(v), key(k) {}
+    };
+    
+    HeapNode* heap;
+    int* position; // pozycja wierzcholka w kopcu
+    int size;
+    int capacity;
+    
+    void swapNodes(int i, int j) {
+        position[heap[i].vertex] = j;
+        position[heap[j].vertex] = i;
+        
+        HeapNode temp = heap[i];
+        heap[i] = heap[j];
+        heap[j] = temp;
+    }
+    
+    void heapifyUp(int index) {
+        while(index > 0) {
+            int parent = (index - 1) / 2;
+            if(heap[parent].key <= heap[index].key) break;
+            swapNodes(parent, index);
+            index = parent;
+        }
+    }
+    
+    void heapifyDown(int index) {
+        while(true) {
+            int left = 2 * index + 1;
+            int right = 2 * index + 2;
+            int smallest = index;
+            
+            if(left < size && heap[left].key < heap[smallest].key)
+                smallest = left;
+            if(right < size && heap[right].key < heap[smallest].key)
+                smallest = right;
+                
+            if(smallest == index) break;
+            
+            swapNodes(index, smallest);
+            index = smallest;
+        }
+    }
+    
+public:
+    MinHeap(int cap) : size(0), capacity(cap) {
+        heap = new HeapNode[capacity];
+        position = new int[capacity];
+        for(int i = 0; i < capacity; i++) {
+            position[i] = -1;
+        }
+    }
+    
+    ~MinHeap() {
+        delete[] heap;
+        delete[] position;
+    }
+    
+    bool isEmpty() { return size == 0; }
+    
+    // Klucz minimum bez usuwania go z kopca (INT_MAX dla pustego kopca)
+    int minKey() { return size > 0 ? heap[0].key : INT_MAX; }
+    
+    void insert(int vertex, int key) {
+        if(size >= capacity) return;
+        
+        heap[size] = HeapNode(vertex, key);
+        position[vertex] = size;
+        size++;
+        heapifyUp(size - 1);
+    }
+    
+    HeapNode extractMin() {
+        if(size == 0) return HeapNode();
+        
+        HeapNode min = heap[0];
+        position[min.vertex] = -1;
+        
+        heap[0] = heap[size - 1];
+        if(size > 1) position[heap[0].vertex] = 0;
+        size--;
+        
+        if(size > 0) heapifyDown(0);
+        
+        return min;
+    }
+    
+    void decreaseKey(int vertex, int newKey) {
+        int pos = position[vertex];
+        if(pos == -1 || pos >= size) return;
+        
+        heap[pos].key = newKey;
+        heapifyUp(pos);
+    }
+    
+    bool isInHeap(int vertex) {
+        return position[vertex] != -1 && position[vertex] < size;
+    }
+    
+    // Oproznienie kopca bez realokacji (ponowne uzycie w kolejnych zapytaniach)
+    void clear() {
+        for(int i = 0; i < size; i++) {
+            position[heap[i].vertex] = -1;
+        }
+        size = 0;
+    }
+};
+
+#endif
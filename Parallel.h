@@ -0,0 +1,75 @@
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+#include <thread>
+#include <atomic>
+
+#if defined(__linux__)
+#include <sched.h>
+#include <pthread.h>
+#endif
+
+// Domyslna liczba watkow roboczych (co najmniej 1)
+inline int defaultThreadCount() {
+    int threads = (int)std::thread::hardware_concurrency();
+    return threads > 0 ? threads : 1;
+}
+
+// Przypiecie biezacego watku do rdzenia: slot-ty dozwolony procesor procesu,
+// po pominieciu pierwszych skip (np. rdzen zostawiony systemowi). Zwraca false,
+// gdy system nie wspiera przypinania lub brak wystarczajacej liczby rdzeni.
+inline bool pinCurrentThread(int slot, int skip) {
+#if defined(__linux__)
+    cpu_set_t allowed;
+    if(sched_getaffinity(0, sizeof(allowed), &allowed) != 0) return false;
+    int wanted = slot + skip;
+    for(int cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+        if(!CPU_ISSET(cpu, &allowed)) continue;
+        if(wanted-- > 0) continue;
+        cpu_set_t target;
+        CPU_ZERO(&target);
+        CPU_SET(cpu, &target);
+        return pthread_setaffinity_np(pthread_self(), sizeof(target), &target) == 0;
+    }
+    return false;
+#else
+    (void)slot;
+    (void)skip;
+    return false;
+#endif
+}
+
+// Pula watkow dla zadan niezaleznych: zadania 0..num_tasks-1 sa pobierane
+// z licznika atomowego, wiec dluzsze zadania nie blokuja pozostalych watkow.
+// fn(task, thread_id) - thread_id wskazuje bufory robocze danego watku.
+template <typename Fn>
+void parallelFor(int num_tasks, int num_threads, Fn fn) {
+    if(num_threads < 1) num_threads = 1;
+    if(num_threads > num_tasks) num_threads = num_tasks;
+
+    if(num_threads <= 1) {
+        for(int task = 0; task < num_tasks; task++) {
+            fn(task, 0);
+        }
+        return;
+    }
+
+    std::atomic<int> next_task(0);
+    std::thread* workers = new std::thread[num_threads];
+
+    for(int t = 0; t < num_threads; t++) {
+        workers[t] = std::thread([&next_task, &fn, num_tasks, t]() {
+            int task;
+            while((task = next_task.fetch_add(1)) < num_tasks) {
+                fn(task, t);
+            }
+        });
+    }
+
+    for(int t = 0; t < num_threads; t++) {
+        workers[t].join();
+    }
+    delete[] workers;
+}
+
+#endif
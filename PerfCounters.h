@@ -0,0 +1,154 @@
+#ifndef PERFCOUNTERS_H
+#define PERFCOUNTERS_H
+
+#include <iostream>
+#include <iomanip>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <cstring>
+#endif
+
+enum PerfEvent {
+    PERF_CYCLES = 0,
+    PERF_INSTRUCTIONS,
+    PERF_L1D_MISSES,
+    PERF_LLC_MISSES,
+    PERF_BRANCH_MISSES,
+    PERF_EVENT_COUNT
+};
+
+inline const char* perfEventName(int event) {
+    switch(event) {
+        case PERF_CYCLES: return "cykle";
+        case PERF_INSTRUCTIONS: return "instrukcje";
+        case PERF_L1D_MISSES: return "chybienia L1D";
+        case PERF_LLC_MISSES: return "chybienia LLC";
+        case PERF_BRANCH_MISSES: return "bledne predykcje skokow";
+        default: return "?";
+    }
+}
+
+// Sprzetowe liczniki wydajnosci oparte o perf_event_open (tylko Linux).
+// Kazde zdarzenie otwierane jest osobno, wiec brak jednego licznika (np. LLC
+// w maszynie wirtualnej) nie wylacza pozostalych. Przy multipleksowaniu
+// licznikow przez jadro wartosci sa skalowane wedlug czasu pomiaru.
+// Na innych systemach lub przy braku uprawnien (perf_event_paranoid) available() == false.
+class PerfCounters {
+private:
+    int fd[PERF_EVENT_COUNT];
+    long long values[PERF_EVENT_COUNT];
+
+#if defined(__linux__)
+    static int openEvent(unsigned int type, unsigned long long config) {
+        struct perf_event_attr attr;
+        memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = type;
+        attr.config = config;
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.inherit = 1; // watki tworzone w trakcie pomiaru (silniki rownolegle)
+        attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+        return (int)syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+    }
+#endif
+
+public:
+    PerfCounters() {
+        for(int e = 0; e < PERF_EVENT_COUNT; e++) {
+            fd[e] = -1;
+            values[e] = 0;
+        }
+#if defined(__linux__)
+        fd[PERF_CYCLES] = openEvent(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+        fd[PERF_INSTRUCTIONS] = openEvent(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+        fd[PERF_L1D_MISSES] = openEvent(PERF_TYPE_HW_CACHE,
+            PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16));
+        fd[PERF_LLC_MISSES] = openEvent(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES);
+        fd[PERF_BRANCH_MISSES] = openEvent(PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES);
+#endif
+    }
+
+    ~PerfCounters() {
+#if defined(__linux__)
+        for(int e = 0; e < PERF_EVENT_COUNT; e++) {
+            if(fd[e] >= 0) close(fd[e]);
+        }
+#endif
+    }
+
+    bool available() {
+        for(int e = 0; e < PERF_EVENT_COUNT; e++) {
+            if(fd[e] >= 0) return true;
+        }
+        return false;
+    }
+
+    bool has(int event) { return fd[event] >= 0; }
+
+    void start() {
+#if defined(__linux__)
+        for(int e = 0; e < PERF_EVENT_COUNT; e++) {
+            if(fd[e] >= 0) {
+                ioctl(fd[e], PERF_EVENT_IOC_RESET, 0);
+                ioctl(fd[e], PERF_EVENT_IOC_ENABLE, 0);
+            }
+        }
+#endif
+    }
+
+    void stop() {
+#if defined(__linux__)
+        for(int e = 0; e < PERF_EVENT_COUNT; e++) {
+            if(fd[e] >= 0) ioctl(fd[e], PERF_EVENT_IOC_DISABLE, 0);
+        }
+        for(int e = 0; e < PERF_EVENT_COUNT; e++) {
+            values[e] = 0;
+            if(fd[e] < 0) continue;
+
+            unsigned long long data[3]; // wartosc, czas wlaczenia, czas zliczania
+            if(read(fd[e], data, sizeof(data)) != (ssize_t)sizeof(data)) continue;
+            if(data[2] > 0 && data[2] < data[1]) {
+                values[e] = (long long)((double)data[0] * data[1] / data[2]);
+            } else {
+                values[e] = (long long)data[0];
+            }
+        }
+#endif
+    }
+
+    long long value(int event) { return values[event]; }
+
+    // Dodanie wynikow ostatniego pomiaru do sum danej komorki testow
+    void accumulate(long long* totals) {
+        for(int e = 0; e < PERF_EVENT_COUNT; e++) {
+            totals[e] += values[e];
+        }
+    }
+
+    // Srednie wartosci licznikow na jedno uruchomienie
+    void printAverages(const long long* totals, int runs) {
+        if(!available()) {
+            std::cout << "liczniki sprzetowe niedostepne" << std::endl;
+            return;
+        }
+        std::cout << "liczniki (srednio):";
+        for(int e = 0; e < PERF_EVENT_COUNT; e++) {
+            std::cout << " " << perfEventName(e) << " = ";
+            if(has(e)) std::cout << totals[e] / runs;
+            else std::cout << "-";
+        }
+        if(has(PERF_CYCLES) && has(PERF_INSTRUCTIONS) && totals[PERF_CYCLES] > 0) {
+            std::cout << " IPC = " << std::fixed << std::setprecision(2)
+                      << (double)totals[PERF_INSTRUCTIONS] / totals[PERF_CYCLES];
+        }
+        std::cout << std::endl;
+    }
+};
+
+#endif
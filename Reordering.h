@@ -0,0 +1,151 @@
+#ifndef REORDERING_H
+#define REORDERING_H
+
+// Zmiana numeracji wierzcholkow dla lepszej lokalnosci pamieci.
+// Wiersze listy sasiedztwa maja postac [sasiad, ...] (stride 1)
+// lub [sasiad, waga, sasiad, waga, ...] (stride 2).
+
+enum VertexOrdering {
+    ORDER_ORIGINAL = 0, // numeracja z pliku / generatora
+    ORDER_BFS = 1,      // kolejnosc odwiedzin przeszukiwania wszerz
+    ORDER_RCM = 2,      // odwrocony algorytm Cuthilla-McKee
+    ORDER_DEGREE = 3    // malejace stopnie wierzcholkow
+};
+
+inline const char* orderingName(int ordering) {
+    switch(ordering) {
+        case ORDER_BFS: return "BFS";
+        case ORDER_RCM: return "RCM";
+        case ORDER_DEGREE: return "stopnie";
+        default: return "oryginalna";
+    }
+}
+
+// Sortowanie przez kopcowanie rekordow o dlugosci stride wedlug klucza key[rekord[0]]
+// (key == nullptr - wedlug samej wartosci rekord[0])
+inline void heapSortRecords(int* items, int count, int stride, const int* key) {
+    auto value = [&](int i) { return key ? key[items[i * stride]] : items[i * stride]; };
+    auto swapRecords = [&](int a, int b) {
+        for(int s = 0; s < stride; s++) {
+            int temp = items[a * stride + s];
+            items[a * stride + s] = items[b * stride + s];
+            items[b * stride + s] = temp;
+        }
+    };
+    auto siftDown = [&](int i, int n) {
+        while(true) {
+            int largest = i;
+            int left = 2 * i + 1;
+            int right = 2 * i + 2;
+            if(left < n && value(left) > value(largest)) largest = left;
+            if(right < n && value(right) > value(largest)) largest = right;
+            if(largest == i) break;
+            swapRecords(i, largest);
+            i = largest;
+        }
+    };
+
+    for(int i = count / 2 - 1; i >= 0; i--) siftDown(i, count);
+    for(int i = count - 1; i > 0; i--) {
+        swapRecords(0, i);
+        siftDown(0, i);
+    }
+}
+
+// Wyznacza new_id[stary] dla wybranego uporzadkowania
+inline void computeOrdering(int ordering, int vertices, int** adjacency_list, const int* list_sizes,
+                            int stride, int* new_id) {
+    int* order = new int[vertices]; // order[nowy] = stary
+
+    if(ordering == ORDER_BFS || ordering == ORDER_RCM) {
+        bool* visited = new bool[vertices];
+        int* starts = new int[vertices];
+        int* buffer = new int[vertices];
+        for(int i = 0; i < vertices; i++) {
+            visited[i] = false;
+            starts[i] = i;
+        }
+
+        // RCM zaczyna kolejne skladowe od wierzcholkow o najmniejszym stopniu
+        if(ordering == ORDER_RCM) {
+            heapSortRecords(starts, vertices, 1, list_sizes);
+        }
+
+        int head = 0, tail = 0;
+        for(int s = 0; s < vertices; s++) {
+            int start = starts[s];
+            if(visited[start]) continue;
+            visited[start] = true;
+            order[tail++] = start;
+
+            while(head < tail) {
+                int u = order[head++];
+                int count = 0;
+                for(int j = 0; j < list_sizes[u]; j++) {
+                    int v = adjacency_list[u][j * stride];
+                    if(!visited[v]) {
+                        visited[v] = true;
+                        buffer[count++] = v;
+                    }
+                }
+                if(ordering == ORDER_RCM) {
+                    heapSortRecords(buffer, count, 1, list_sizes);
+                }
+                for(int j = 0; j < count; j++) {
+                    order[tail++] = buffer[j];
+                }
+            }
+        }
+
+        if(ordering == ORDER_RCM) {
+            for(int i = 0; i < vertices / 2; i++) {
+                int temp = order[i];
+                order[i] = order[vertices - 1 - i];
+                order[vertices - 1 - i] = temp;
+            }
+        }
+
+        delete[] visited;
+        delete[] starts;
+        delete[] buffer;
+    } else if(ordering == ORDER_DEGREE) {
+        // Sortowanie przez zliczanie (stabilne) wedlug malejacego stopnia
+        int max_degree = 0;
+        for(int u = 0; u < vertices; u++) {
+            if(list_sizes[u] > max_degree) max_degree = list_sizes[u];
+        }
+        int* bucket = new int[max_degree + 2];
+        for(int d = 0; d <= max_degree + 1; d++) bucket[d] = 0;
+        for(int u = 0; u < vertices; u++) bucket[max_degree - list_sizes[u] + 1]++;
+        for(int d = 0; d <= max_degree; d++) bucket[d + 1] += bucket[d];
+        for(int u = 0; u < vertices; u++) order[bucket[max_degree - list_sizes[u]]++] = u;
+        delete[] bucket;
+    } else {
+        for(int i = 0; i < vertices; i++) order[i] = i;
+    }
+
+    for(int i = 0; i < vertices; i++) {
+        new_id[order[i]] = i;
+    }
+    delete[] order;
+}
+
+// Miara lokalnosci: srednia odleglosc numerow koncow krawedzi oraz szerokosc pasma
+inline void orderingLocality(int vertices, int** adjacency_list, const int* list_sizes, int stride,
+                             double& average_gap, int& bandwidth) {
+    long long total_gap = 0;
+    long long edges = 0;
+    bandwidth = 0;
+    for(int u = 0; u < vertices; u++) {
+        for(int j = 0; j < list_sizes[u]; j++) {
+            int v = adjacency_list[u][j * stride];
+            int gap = u > v ? u - v : v - u;
+            total_gap += gap;
+            if(gap > bandwidth) bandwidth = gap;
+            edges++;
+        }
+    }
+    average_gap = edges > 0 ? (double)total_gap / edges : 0.0;
+}
+
+#endif
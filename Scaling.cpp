@@ -0,0 +1,189 @@
+#include "Scaling.h"
+#include <iostream>
+#include <iomanip>
+#include <cmath>
+
+const char* complexityModelName(int model) {
+    switch(model) {
+        case MODEL_E: return "E";
+        case MODEL_V2: return "V^2";
+        case MODEL_E_LOG_V: return "E log V";
+        case MODEL_E_PLUS_V_LOG_V: return "E + V log V";
+        case MODEL_VE: return "V E";
+        case MODEL_V3: return "V^3";
+        default: return "?";
+    }
+}
+
+double complexityModelValue(int model, double vertices, double edges) {
+    double log_v = std::log2(vertices > 2.0 ? vertices : 2.0);
+    switch(model) {
+        case MODEL_E: return edges;
+        case MODEL_V2: return vertices * vertices;
+        case MODEL_E_LOG_V: return edges * log_v;
+        case MODEL_E_PLUS_V_LOG_V: return edges + vertices * log_v;
+        case MODEL_VE: return vertices * edges;
+        case MODEL_V3: return vertices * vertices * vertices;
+        default: return 0.0;
+    }
+}
+
+long long generatedEdgeCount(int vertices, int density, bool directed) {
+    long long max_edges = (long long)vertices * (vertices - 1);
+    if(!directed) max_edges /= 2;
+    long long edges = (max_edges * density) / 100;
+    long long connecting = directed ? (vertices > 1 ? vertices : 0) : (vertices > 0 ? vertices - 1 : 0);
+    return edges > connecting ? edges : connecting;
+}
+
+ComplexityFit fitComplexity(const ScalingPoint* points, int count, int stride, int model) {
+    ComplexityFit fit;
+    fit.model = model;
+    fit.offset = 0.0;
+    fit.constant = 0.0;
+    fit.error = 1e9;
+    
+    // Wazone najmniejsze kwadraty (wagi 1/t^2) dla t = a + c f: uklad 2x2
+    double sw = 0.0, sf = 0.0, sff = 0.0, st = 0.0, sft = 0.0;
+    int used = 0;
+    for(int i = 0; i < count; i++) {
+        const ScalingPoint& point = points[i * stride];
+        if(point.time <= 0.0) continue;
+        double weight = 1.0 / (point.time * point.time);
+        double value = complexityModelValue(model, point.vertices, (double)point.edges);
+        sw += weight;
+        sf += weight * value;
+        sff += weight * value * value;
+        st += weight * point.time;
+        sft += weight * value * point.time;
+        used++;
+    }
+    if(used == 0 || sff <= 0.0) return fit;
+    
+    double determinant = sw * sff - sf * sf;
+    if(used >= 3 && determinant > 1e-12 * sw * sff) {
+        fit.offset = (st * sff - sf * sft) / determinant;
+        fit.constant = (sw * sft - sf * st) / determinant;
+    }
+    // Ujemny narzut lub ujemna stala nie maja sensu - dopasowanie przez zero
+    if(fit.offset < 0.0 || fit.constant <= 0.0) {
+        fit.offset = 0.0;
+        fit.constant = sft / sff;
+    }
+    
+    double squares = 0.0;
+    for(int i = 0; i < count; i++) {
+        const ScalingPoint& point = points[i * stride];
+        if(point.time <= 0.0) continue;
+        double predicted = fit.offset + fit.constant * complexityModelValue(model, point.vertices, (double)point.edges);
+        double relative = (point.time - predicted) / point.time;
+        squares += relative * relative;
+    }
+    fit.error = std::sqrt(squares / used);
+    return fit;
+}
+
+double predictComplexity(const ComplexityFit& fit, double vertices, double edges) {
+    return fit.offset + fit.constant * complexityModelValue(fit.model, vertices, edges);
+}
+
+static bool hasRepresentation(const AlgorithmInfo& algorithm, int representation) {
+    return (algorithm.representations & (1 << representation)) != 0;
+}
+
+// Przeciecie wg modeli: najmniejsze V (krok 5%), od ktorego zmienia sie znak
+// roznicy czasow przewidywanych dla obu reprezentacji; 0 - brak w zakresie
+static int modelCrossover(const ComplexityFit& matrix, const ComplexityFit& list, int density, bool directed,
+                          int from, int to) {
+    double previous = 0.0;
+    for(double v = from; v <= to; v *= 1.05) {
+        int vertices = (int)v;
+        double edges = (double)generatedEdgeCount(vertices, density, directed);
+        double difference = predictComplexity(matrix, vertices, edges) - predictComplexity(list, vertices, edges);
+        if(previous != 0.0 && (difference < 0.0) != (previous < 0.0)) return vertices;
+        previous = difference;
+    }
+    return 0;
+}
+
+void printScalingReport(const AlgorithmInfo& algorithm, const ScalingPoint* points, int cell_count,
+                        const int* densities, int num_densities) {
+    std::cout << "\n=== SKALOWANIE: " << algorithm.title << " ===" << std::endl;
+    
+    ComplexityFit best[REP_COUNT];
+    for(int representation = 0; representation < REP_COUNT; representation++) {
+        if(!hasRepresentation(algorithm, representation)) continue;
+        
+        ComplexityFit fits[MODEL_COUNT];
+        int chosen = 0;
+        for(int model = 0; model < MODEL_COUNT; model++) {
+            fits[model] = fitComplexity(points + representation, cell_count, REP_COUNT, model);
+            if(fits[model].error < fits[chosen].error) chosen = model;
+        }
+        best[representation] = fits[chosen];
+        
+        std::cout << "reprezentacja " << representationName(representation) << " (t = a + c * f, blad wzgledny RMS):" << std::endl;
+        for(int model = 0; model < MODEL_COUNT; model++) {
+            std::cout << "  " << std::left << std::setw(12) << complexityModelName(model) << std::right
+                      << " a = " << std::scientific << std::setprecision(3) << fits[model].offset
+                      << " c = " << fits[model].constant
+                      << "  blad = " << std::fixed << std::setprecision(1) << fits[model].error * 100.0 << "%"
+                      << (model == chosen ? "  <- najlepszy" : "") << std::endl;
+        }
+    }
+    
+    if(!hasRepresentation(algorithm, REP_MATRIX) || !hasRepresentation(algorithm, REP_LIST)) return;
+    
+    // Stosunek czasu macierzowej do listowej: > 1 - szybsza lista
+    bool directed = algorithm.kind != GRAPH_UNDIRECTED;
+    int num_sizes = cell_count / num_densities;
+    std::cout << "czas macierzowa / listowa (> 1 - szybsza listowa):" << std::endl;
+    std::cout << std::setw(9) << "gestosc";
+    for(int size = 0; size < num_sizes; size++) {
+        std::cout << std::setw(9) << points[(size * num_densities) * REP_COUNT].vertices;
+    }
+    std::cout << "   przeciecie: pomiar / model" << std::endl;
+    
+    int smallest = points[0].vertices;
+    int largest = points[((num_sizes - 1) * num_densities) * REP_COUNT].vertices;
+    for(int d = 0; d < num_densities; d++) {
+        std::cout << std::setw(8) << densities[d] << "%";
+        double previous_log = 0.0;
+        int measured = 0;
+        int last_winner = -1;
+        for(int size = 0; size < num_sizes; size++) {
+            const ScalingPoint* cell = points + (size * num_densities + d) * REP_COUNT;
+            double matrix_time = cell[REP_MATRIX].time, list_time = cell[REP_LIST].time;
+            if(matrix_time <= 0.0 || list_time <= 0.0) {
+                std::cout << std::setw(9) << "-";
+                continue;
+            }
+            std::cout << std::setw(9) << std::setprecision(2) << matrix_time / list_time;
+            last_winner = matrix_time > list_time ? REP_LIST : REP_MATRIX;
+            
+            // Przeciecie z pomiarow: interpolacja log(stosunku) w skali log V
+            double ratio_log = std::log(matrix_time / list_time);
+            if(size > 0 && measured == 0 && previous_log != 0.0 && (ratio_log < 0.0) != (previous_log < 0.0)) {
+                double v1 = std::log((double)cell[-num_densities * REP_COUNT].vertices);
+                double v2 = std::log((double)cell[0].vertices);
+                measured = (int)std::exp(v1 + (0.0 - previous_log) * (v2 - v1) / (ratio_log - previous_log));
+            }
+            previous_log = ratio_log;
+        }
+        
+        // Model siega o czynnik 4 poza zakres pomiarow w obie strony
+        int predicted = modelCrossover(best[REP_MATRIX], best[REP_LIST], densities[d], directed,
+                                       smallest / 4 > 2 ? smallest / 4 : 2, largest * 4);
+        std::cout << "   ";
+        if(measured > 0) {
+            std::cout << "V ~ " << measured;
+        } else if(last_winner >= 0) {
+            std::cout << "brak (szybsza " << representationName(last_winner) << ")";
+        } else {
+            std::cout << "brak";
+        }
+        std::cout << " / ";
+        if(predicted > 0) std::cout << "V ~ " << predicted; else std::cout << "brak";
+        std::cout << std::endl;
+    }
+}
@@ -0,0 +1,53 @@
+#ifndef SCALING_H
+#define SCALING_H
+
+#include "Algorithms.h"
+
+// Analiza skalowania: mediany czasow z przegladu rozmiarow i gestosci dopasowywane
+// do modeli zlozonosci t = a + c * f(V, E) oraz punkty, w ktorych reprezentacja
+// listowa zaczyna wygrywac z macierzowa (lub odwrotnie).
+
+enum ComplexityModel {
+    MODEL_E = 0,
+    MODEL_V2,
+    MODEL_E_LOG_V,
+    MODEL_E_PLUS_V_LOG_V,
+    MODEL_VE,
+    MODEL_V3,
+    MODEL_COUNT
+};
+
+const char* complexityModelName(int model);
+double complexityModelValue(int model, double vertices, double edges);
+
+// Mediana czasu jednego zestawu przegladu (time <= 0 - brak pomiaru)
+struct ScalingPoint {
+    int vertices;
+    int density;
+    long long edges;
+    double time;
+};
+
+// Dopasowanie jednego modelu t = a + c * f(V, E): narzut a (alokacje, inicjalizacja),
+// stala c i sredniokwadratowy blad wzgledny na punktach pomiarowych
+struct ComplexityFit {
+    int model;
+    double offset;
+    double constant;
+    double error;
+};
+
+// Liczba krawedzi grafu z generateRandomForTesting (gestosc, ale co najmniej
+// drzewo rozpinajace lub cykl Hamiltona zapewniajace spojnosc)
+long long generatedEdgeCount(int vertices, int density, bool directed);
+
+// Minimalizacja sumy ((t - a - c f) / t)^2 - kazdy rozmiar wazy tyle samo
+ComplexityFit fitComplexity(const ScalingPoint* points, int count, int stride, int model);
+double predictComplexity(const ComplexityFit& fit, double vertices, double edges);
+
+// Raport dla algorytmu: points[c * REP_COUNT + r] - zestaw c, reprezentacja r;
+// zestawy ulozone rozmiarami rosnaco, a w ramach rozmiaru gestosciami.
+void printScalingReport(const AlgorithmInfo& algorithm, const ScalingPoint* points, int cell_count,
+                        const int* densities, int num_densities);
+
+#endif
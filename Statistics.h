@@ -0,0 +1,131 @@
+#ifndef STATISTICS_H
+#define STATISTICS_H
+
+#include <cmath>
+
+// Statystyki serii pomiarow czasu. Czasy nie maja rozkladu normalnego (pojedyncze
+// dlugie przebiegi przez przerwania i pamiec podreczna), dlatego przedzial ufnosci
+// dotyczy mediany i wynika ze statystyk pozycyjnych, bez zalozen o rozkladzie.
+
+struct MedianInterval {
+    double median;
+    double low;
+    double high;
+    bool valid; // false - za malo pomiarow dla zadanego poziomu ufnosci
+    
+    MedianInterval() : median(0.0), low(0.0), high(0.0), valid(false) {}
+    
+    // Polowa szerokosci przedzialu wzgledem mediany (0.05 = +-5%)
+    double relativeHalfWidth() const {
+        if(!valid || median <= 0.0) return 1e9;
+        return (high - low) / (2.0 * median);
+    }
+};
+
+// Sortowanie przez wstawianie - serie maja najwyzej kilkaset pomiarow
+inline void sortSamples(double* samples, int n) {
+    for(int i = 1; i < n; i++) {
+        double value = samples[i];
+        int j = i - 1;
+        while(j >= 0 && samples[j] > value) {
+            samples[j + 1] = samples[j];
+            j--;
+        }
+        samples[j + 1] = value;
+    }
+}
+
+// P(X <= k) dla X ~ Bin(n, 1/2), w skali logarytmicznej (bez niedomiaru dla duzych n)
+inline double binomialHalfCdf(int n, int k) {
+    double sum = 0.0;
+    for(int i = 0; i <= k && i <= n; i++) {
+        sum += std::exp(std::lgamma(n + 1.0) - std::lgamma(i + 1.0) - std::lgamma(n - i + 1.0) - n * std::log(2.0));
+    }
+    return sum;
+}
+
+// Mediana i najwezszy przedzial [x_(j), x_(n+1-j)] o pokryciu co najmniej confidence
+inline MedianInterval medianInterval(const double* samples, int n, double confidence = 0.95) {
+    MedianInterval result;
+    if(n <= 0) return result;
+    
+    double* sorted = new double[n];
+    for(int i = 0; i < n; i++) sorted[i] = samples[i];
+    sortSamples(sorted, n);
+    
+    result.median = (n % 2 == 1) ? sorted[n / 2] : (sorted[n / 2 - 1] + sorted[n / 2]) / 2.0;
+    
+    // Pokrycie przedzialu z pozycjami j i n+1-j (od 1) wynosi 1 - 2 P(X <= j-1)
+    int best = 0;
+    for(int j = 1; 2 * j <= n + 1; j++) {
+        if(1.0 - 2.0 * binomialHalfCdf(n, j - 1) < confidence) break;
+        best = j;
+    }
+    if(best > 0) {
+        result.low = sorted[best - 1];
+        result.high = sorted[n - best];
+        result.valid = true;
+    }
+    
+    delete[] sorted;
+    return result;
+}
+
+// Test Manna-Whitneya (dwustronny): czy czasy z dwoch serii pochodza z tego samego
+// rozkladu. Przyblizenie normalne z poprawka na remisy i ciaglosc; zwraca p-wartosc.
+// Dla bardzo malych serii (np. 3 i 3) p nie spada ponizej ~0.08 - brak rozstrzygniecia
+// (mannWhitneyMinP).
+inline double mannWhitneyP(const double* first, int n1, const double* second, int n2) {
+    if(n1 <= 0 || n2 <= 0) return 1.0;
+    int n = n1 + n2;
+    double* values = new double[n];
+    for(int i = 0; i < n1; i++) values[i] = first[i];
+    for(int i = 0; i < n2; i++) values[n1 + i] = second[i];
+    sortSamples(values, n);
+    
+    // Suma rang pierwszej serii (rangi srednie dla remisow) i poprawka wariancji
+    double rank_sum = 0.0;
+    double ties = 0.0;
+    for(int i = 0; i < n; ) {
+        int j = i;
+        while(j + 1 < n && values[j + 1] == values[i]) j++;
+        double rank = (i + j + 2) / 2.0;
+        int in_first = 0;
+        for(int k = 0; k < n1; k++) {
+            if(first[k] == values[i]) in_first++;
+        }
+        rank_sum += rank * in_first;
+        double t = j - i + 1;
+        ties += t * t * t - t;
+        i = j + 1;
+    }
+    delete[] values;
+    
+    double u = rank_sum - n1 * (n1 + 1) / 2.0;
+    double mean = n1 * (double)n2 / 2.0;
+    double variance = n1 * (double)n2 / 12.0 * ((n + 1) - ties / ((double)n * (n - 1)));
+    if(variance <= 0.0) return 1.0;
+    double z = (std::fabs(u - mean) - 0.5) / std::sqrt(variance);
+    if(z < 0.0) z = 0.0;
+    return std::erfc(z / std::sqrt(2.0));
+}
+
+// Najmniejsza p-wartosc osiagalna przez mannWhitneyP dla serii n1 i n2 (serie calkowicie
+// rozdzielone, bez remisow). Jesli nie jest mniejsza od poziomu istotnosci, test nie moze
+// niczego wykazac niezaleznie od wynikow.
+inline double mannWhitneyMinP(int n1, int n2) {
+    if(n1 <= 0 || n2 <= 0) return 1.0;
+    double mean = n1 * (double)n2 / 2.0;
+    double variance = n1 * (double)n2 / 12.0 * (n1 + n2 + 1);
+    double z = (mean - 0.5) / std::sqrt(variance);
+    return std::erfc(z / std::sqrt(2.0));
+}
+
+// Najmniejsza rowna liczebnosc obu serii, przy ktorej test moze osiagnac poziom significance
+inline int mannWhitneyMinSamples(double significance) {
+    int n = 2;
+    while(n < 1000 && mannWhitneyMinP(n, n) >= significance) n++;
+    return n;
+}
+
+#endif
@@ -0,0 +1,93 @@
+#ifndef VERIFICATION_H
+#define VERIFICATION_H
+
+// Tryb weryfikacji: wszystkie warianty algorytmu (macierz, lista, kolejne silniki)
+// uruchamiane na tej samej instancji musza dac identyczne wyniki.
+// Kazda instancja jest wyznaczona przez swoje ziarno, wiec niezgodnosc mozna odtworzyc
+// podajac w menu weryfikacji to samo ziarno, liczbe wierzcholkow i gestosc.
+
+#include <iostream>
+#include <string>
+#include <ctime>
+
+struct VerificationContext {
+    unsigned int seed;
+    int vertices;
+    int density;
+    int mismatches;
+
+    VerificationContext() : seed(0), vertices(0), density(0), mismatches(0) {}
+};
+
+// Mieszanie bitow ziarna - parametry instancji nie zaleza od strumienia rand()
+inline unsigned int mixSeed(unsigned int x) {
+    x ^= x >> 16;
+    x *= 0x7feb352dU;
+    x ^= x >> 15;
+    x *= 0x846ca68bU;
+    x ^= x >> 16;
+    return x;
+}
+
+inline void reportMismatch(VerificationContext& ctx, const std::string& variant, const std::string& detail) {
+    ctx.mismatches++;
+    std::cout << "NIEZGODNOSC (ziarno = " << ctx.seed << ", wierzcholki = " << ctx.vertices
+              << ", gestosc = " << ctx.density << "%): " << variant << " - " << detail << std::endl;
+}
+
+// Porownanie pojedynczej wartosci (waga MST, odleglosc do celu, werdykt cyklu ujemnego)
+inline bool checkValue(VerificationContext& ctx, const std::string& variant, long long expected, long long actual) {
+    if(expected == actual) return true;
+    reportMismatch(ctx, variant, "oczekiwano " + std::to_string(expected) + ", otrzymano " + std::to_string(actual));
+    return false;
+}
+
+// Porownanie tablic odleglosci - raportowana jest pierwsza rozbieznosc
+inline bool checkDistances(VerificationContext& ctx, const std::string& variant, const int* expected, const int* actual, int n) {
+    for(int i = 0; i < n; i++) {
+        if(expected[i] != actual[i]) {
+            reportMismatch(ctx, variant, "wierzcholek " + std::to_string(i) + ": oczekiwano "
+                           + std::to_string(expected[i]) + ", otrzymano " + std::to_string(actual[i]));
+            return false;
+        }
+    }
+    return true;
+}
+
+// Testy losowe: duza liczba malych grafow, kazdy z kolejnym ziarnem.
+// Liczba wierzcholkow i gestosc podane jako 0 sa losowane z ziarna instancji.
+// verify(ctx) generuje instancje dla ctx i porownuje warianty (zwieksza ctx.mismatches).
+template <typename Fn>
+void runFuzzing(Fn verify) {
+    int count, v, density;
+    unsigned int base_seed;
+    std::cout << "Podaj liczbe grafow: ";
+    std::cin >> count;
+    std::cout << "Podaj liczbe wierzcholkow (0 = losowo 2..40): ";
+    std::cin >> v;
+    std::cout << "Podaj gestosc grafu w % (0 = losowo): ";
+    std::cin >> density;
+    std::cout << "Podaj ziarno poczatkowe (0 = losowe): ";
+    std::cin >> base_seed;
+    if(count <= 0 || v == 1 || v < 0) return;
+    if(base_seed == 0) base_seed = (unsigned int)time(nullptr);
+
+    int failed = 0;
+    int total_mismatches = 0;
+    for(int i = 0; i < count; i++) {
+        VerificationContext ctx;
+        ctx.seed = base_seed + (unsigned int)i;
+        unsigned int mixed = mixSeed(ctx.seed);
+        ctx.vertices = v > 0 ? v : 2 + (int)(mixed % 39);
+        ctx.density = density > 0 ? density : 1 + (int)((mixed >> 8) % 100);
+
+        verify(ctx);
+        if(ctx.mismatches > 0) failed++;
+        total_mismatches += ctx.mismatches;
+    }
+
+    std::cout << "Sprawdzono " << count << " grafow (ziarna " << base_seed << ".." << base_seed + (unsigned int)(count - 1)
+              << "), grafy z niezgodnosciami: " << failed << ", niezgodnosci: " << total_mismatches << std::endl;
+}
+
+#endif
@@ -0,0 +1,146 @@
+#include <iostream>
+#include <string>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include "Algorithms.h"
+#include "Benchmark.h"
+#include "CostModel.h"
+
+// Nieinteraktywny sterownik testow wydajnosci (skrypty pomiarowe, trening PGO).
+// Uzycie: aizo_bench [algorytm|all] [--counters] [--verify] [--generate-ahead] [--instances N]
+//        [--workers N] [--serial] [--pin] [--reserve-core]
+//        [--adaptive] [--ci P] [--budget S] [--min-instances N] [--warmup N]
+//        [--save-baseline PLIK] [--baseline PLIK] [--threshold P] [--alpha A]
+//        [--sweep] [--sweep-vertices MIN MAX] [--sweep-factor F] [--sweep-densities D1,D2,...]
+//        [--calibrate] [--list]
+// Kod wyjscia: 0 - OK, 1 - bledne argumenty, wzorzec nieczytelny lub za maly do rozstrzygniecia, 2 - regresja wzgledem wzorca.
+
+static void printUsage(const char* program) {
+    std::cout << "Uzycie: " << program << " [algorytm|all] [--counters] [--verify] [--generate-ahead] [--instances N]"
+              << " [--workers N] [--serial] [--pin] [--reserve-core]"
+              << " [--adaptive] [--ci P] [--budget S] [--min-instances N] [--warmup N]"
+              << " [--save-baseline PLIK] [--baseline PLIK] [--threshold P] [--alpha A]"
+              << " [--sweep] [--sweep-vertices MIN MAX] [--sweep-factor F] [--sweep-densities D1,D2,...]"
+              << " [--calibrate] [--list]" << std::endl;
+    std::cout << "  --counters        sprzetowe liczniki wydajnosci (Linux perf)" << std::endl;
+    std::cout << "  --verify          sprawdzanie zgodnosci wszystkich wariantow" << std::endl;
+    std::cout << "  --generate-ahead  kolejna instancja generowana w tle podczas pomiaru" << std::endl;
+    std::cout << "  --instances N     najwyzej N instancji na zestaw (0 = wg wymagan)" << std::endl;
+    std::cout << "  --workers N       N watkow pomiarowych, kazdy z wlasna instancja (0 = wszystkie rdzenie)" << std::endl;
+    std::cout << "  --serial          jeden watek pomiarowy (domyslnie)" << std::endl;
+    std::cout << "  --pin             przypiecie watkow pomiarowych do rdzeni" << std::endl;
+    std::cout << "  --reserve-core    pierwszy rdzen zostaje dla systemu" << std::endl;
+    std::cout << "  --adaptive        instancje do osiagniecia przedzialu ufnosci mediany lub budzetu czasu" << std::endl;
+    std::cout << "  --ci P            docelowy 95% CI mediany +-P% (domyslnie 5)" << std::endl;
+    std::cout << "  --budget S        budzet czasu na zestaw w sekundach (domyslnie 30)" << std::endl;
+    std::cout << "  --min-instances N najmniej instancji na zestaw w trybie adaptacyjnym (domyslnie 6)" << std::endl;
+    std::cout << "  --warmup N        przebiegi rozgrzewkowe na zestaw (domyslnie 1 adaptacyjnie, 0 stale)" << std::endl;
+    std::cout << "  --save-baseline PLIK zapis czasow wszystkich instancji jako wzorca" << std::endl;
+    std::cout << "  --baseline PLIK   porownanie ze wzorcem; kod wyjscia 2 przy regresji" << std::endl;
+    std::cout << "  --threshold P     najmniejsza zmiana mediany uznawana za regresje, % (domyslnie 5)" << std::endl;
+    std::cout << "  --alpha A         poziom istotnosci testu Manna-Whitneya (domyslnie 0.01)" << std::endl;
+    std::cout << "  --sweep           przeglad skalowania z dopasowaniem modeli zlozonosci" << std::endl;
+    std::cout << "  --sweep-vertices MIN MAX  zakres rozmiarow przegladu (domyslnie 50 800)" << std::endl;
+    std::cout << "  --sweep-factor F  iloraz kolejnych rozmiarow (domyslnie 2)" << std::endl;
+    std::cout << "  --sweep-densities D1,D2,...  gestosci przegladu w % (domyslnie 10,25,50,75,99)" << std::endl;
+    std::cout << "  --calibrate       przeglad skalowania zapisany do " << COST_MODEL_FILE << " (model kosztu trybu automatycznego)" << std::endl;
+    std::cout << "  --list            lista zarejestrowanych algorytmow" << std::endl;
+}
+
+// Lista gestosci "10,50,99" (1-100%, najwyzej MAX_SWEEP_DENSITIES)
+static bool parseDensities(const char* text, BenchmarkOptions& options) {
+    int count = 0;
+    while(*text) {
+        char* end;
+        long density = strtol(text, &end, 10);
+        if(end == text || density < 1 || density > 100 || count == MAX_SWEEP_DENSITIES) return false;
+        options.sweep_densities[count++] = (int)density;
+        text = end;
+        if(*text == ',') text++;
+        else if(*text) return false;
+    }
+    if(count == 0) return false;
+    options.sweep_density_count = count;
+    return true;
+}
+
+int main(int argc, char** argv) {
+    srand(time(nullptr));
+    const AlgorithmInfo* algorithm = nullptr;
+    BenchmarkOptions options;
+    
+    for(int i = 1; i < argc; i++) {
+        if(strcmp(argv[i], "--counters") == 0) {
+            options.collect_counters = true;
+        } else if(strcmp(argv[i], "--verify") == 0) {
+            options.verify = true;
+        } else if(strcmp(argv[i], "--generate-ahead") == 0) {
+            options.generate_ahead = true;
+        } else if(strcmp(argv[i], "--instances") == 0 && i + 1 < argc) {
+            options.max_tests = atoi(argv[++i]);
+        } else if(strcmp(argv[i], "--workers") == 0 && i + 1 < argc) {
+            options.workers = atoi(argv[++i]);
+        } else if(strcmp(argv[i], "--serial") == 0) {
+            options.workers = 1;
+        } else if(strcmp(argv[i], "--pin") == 0) {
+            options.pin_workers = true;
+        } else if(strcmp(argv[i], "--reserve-core") == 0) {
+            options.reserve_core = true;
+        } else if(strcmp(argv[i], "--adaptive") == 0) {
+            options.adaptive = true;
+        } else if(strcmp(argv[i], "--ci") == 0 && i + 1 < argc) {
+            options.target_ci = atof(argv[++i]) / 100.0;
+        } else if(strcmp(argv[i], "--budget") == 0 && i + 1 < argc) {
+            options.time_budget = atof(argv[++i]);
+        } else if(strcmp(argv[i], "--min-instances") == 0 && i + 1 < argc) {
+            options.min_tests = atoi(argv[++i]);
+        } else if(strcmp(argv[i], "--warmup") == 0 && i + 1 < argc) {
+            options.warmup = atoi(argv[++i]);
+        } else if(strcmp(argv[i], "--save-baseline") == 0 && i + 1 < argc) {
+            options.save_baseline = argv[++i];
+        } else if(strcmp(argv[i], "--baseline") == 0 && i + 1 < argc) {
+            options.compare_baseline = argv[++i];
+        } else if(strcmp(argv[i], "--threshold") == 0 && i + 1 < argc) {
+            options.regression_threshold = atof(argv[++i]) / 100.0;
+        } else if(strcmp(argv[i], "--alpha") == 0 && i + 1 < argc) {
+            options.significance = atof(argv[++i]);
+        } else if(strcmp(argv[i], "--sweep") == 0) {
+            options.sweep = true;
+        } else if(strcmp(argv[i], "--sweep-vertices") == 0 && i + 2 < argc) {
+            options.sweep = true;
+            options.sweep_min_vertices = atoi(argv[++i]);
+            options.sweep_max_vertices = atoi(argv[++i]);
+        } else if(strcmp(argv[i], "--sweep-factor") == 0 && i + 1 < argc) {
+            options.sweep = true;
+            options.sweep_factor = atof(argv[++i]);
+        } else if(strcmp(argv[i], "--sweep-densities") == 0 && i + 1 < argc) {
+            options.sweep = true;
+            if(!parseDensities(argv[++i], options)) {
+                std::cout << "Nieprawidlowa lista gestosci: " << argv[i] << std::endl;
+                return 1;
+            }
+        } else if(strcmp(argv[i], "--calibrate") == 0) {
+            options.sweep = true;
+            options.save_baseline = COST_MODEL_FILE;
+        } else if(strcmp(argv[i], "--list") == 0) {
+            for(int index = 0; index < algorithmCount(); index++) {
+                std::cout << algorithmAt(index).name << " - " << algorithmAt(index).title << std::endl;
+            }
+            return 0;
+        } else if(argv[i][0] != '-' && strcmp(argv[i], "all") != 0) {
+            algorithm = findAlgorithm(argv[i]);
+            if(!algorithm) {
+                std::cout << "Nieznany algorytm: " << argv[i] << std::endl;
+                return 1;
+            }
+        } else if(argv[i][0] == '-') {
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+    
+    int regressions = performPerformanceTests(algorithm, options);
+    if(regressions < 0) return 1;
+    return regressions > 0 ? 2 : 0;
+}
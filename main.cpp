@@ -0,0 +1,222 @@
+#include <iostream>
+#include <string>
+#include <cstdlib>
+#include <ctime>
+#include "Algorithms.h"
+#include "Benchmark.h"
+#include "CostModel.h"
+
+// Wybor algorytmu z rejestru; allow_all - dodatkowa opcja 0 (wszystkie algorytmy).
+// Zwraca false, gdy wybor jest nieprawidlowy. Program z jednym algorytmem nie pyta.
+static bool chooseAlgorithm(bool allow_all, const AlgorithmInfo*& algorithm) {
+    if(algorithmCount() == 1) {
+        algorithm = &algorithmAt(0);
+        return true;
+    }
+    
+    int choice;
+    std::cout << "\nAlgorytmy:" << std::endl;
+    if(allow_all) std::cout << "0. Wszystkie algorytmy" << std::endl;
+    for(int i = 0; i < algorithmCount(); i++) {
+        std::cout << i + 1 << ". " << algorithmAt(i).title << std::endl;
+    }
+    std::cout << "Wybierz algorytm: ";
+    std::cin >> choice;
+    
+    if(allow_all && choice == 0) {
+        algorithm = nullptr;
+        return true;
+    }
+    if(choice < 1 || choice > algorithmCount()) {
+        std::cout << "Nieprawidlowa opcja!" << std::endl;
+        return false;
+    }
+    algorithm = &algorithmAt(choice - 1);
+    return true;
+}
+
+static bool askYesNo(const char* question) {
+    char answer;
+    std::cout << question << " (t/n): ";
+    std::cin >> answer;
+    return answer == 't' || answer == 'T';
+}
+
+int main() {
+    srand(time(nullptr));
+    Graph* graph = nullptr;
+    int choice;
+    
+    std::cout << "=== ALGORYTMY GRAFOWE - MST I NAJKROTSZE SCIEZKI ===" << std::endl;
+    
+    do {
+        std::cout << "\n--- MENU ---" << std::endl;
+        std::cout << "1. Wczytaj z pliku" << std::endl;
+        std::cout << "2. Wygeneruj graf losowo" << std::endl;
+        std::cout << "3. Wyswietl listowo i macierzowo" << std::endl;
+        std::cout << "4. Uruchom algorytm" << std::endl;
+        std::cout << "5. Testy wydajnosci (zgodnie z wymaganiami)" << std::endl;
+        std::cout << "6. Zmiana numeracji wierzcholkow (BFS/RCM/stopnie)" << std::endl;
+        std::cout << "7. Testy wydajnosci numeracji wierzcholkow" << std::endl;
+        std::cout << "8. Weryfikacja wariantow na losowych grafach" << std::endl;
+        std::cout << "9. Opcje dodatkowe algorytmu" << std::endl;
+        std::cout << "0. Wyjscie" << std::endl;
+        std::cout << "Wybierz opcje: ";
+        std::cin >> choice;
+        
+        switch(choice) {
+            case 1: {
+                std::string filename;
+                std::cout << "Podaj nazwe pliku: ";
+                std::cin >> filename;
+                
+                if(graph) delete graph;
+                graph = new Graph(10, false);
+                graph->loadFromFile(filename);
+                break;
+            }
+            case 2: {
+                int kind, vertices, density;
+                std::cout << "Rodzaj grafu (1 - nieskierowany, 2 - skierowany, 3 - skierowany z ujemnymi wagami): ";
+                std::cin >> kind;
+                if(kind < 1 || kind > 3) {
+                    std::cout << "Nieprawidlowa opcja!" << std::endl;
+                    break;
+                }
+                std::cout << "Podaj liczbe wierzcholkow: ";
+                std::cin >> vertices;
+                std::cout << "Podaj gestosc grafu (w %): ";
+                std::cin >> density;
+                
+                if(graph) delete graph;
+                graph = new Graph(vertices, kind != 1);
+                graph->generateRandom(vertices, density, kind - 1);
+                break;
+            }
+            case 3: {
+                if(graph) {
+                    graph->displayMatrix();
+                    graph->displayList();
+                } else {
+                    std::cout << "Brak grafu! Wczytaj lub wygeneruj graf." << std::endl;
+                }
+                break;
+            }
+            case 4: {
+                if(!graph) {
+                    std::cout << "Brak grafu! Wczytaj lub wygeneruj graf." << std::endl;
+                    break;
+                }
+                const AlgorithmInfo* algorithm;
+                if(!chooseAlgorithm(false, algorithm)) break;
+                
+                // Graf sprawdzany wzgledem silnika, ktory faktycznie ruszy - w trybie
+                // automatycznym moze to byc inny algorytm tego samego problemu
+                int representation;
+                std::cout << "Reprezentacja (";
+                for(int r = 0; r < REP_COUNT; r++) {
+                    if(algorithm->representations & (1 << r)) std::cout << r + 1 << " - " << representationName(r) << ", ";
+                }
+                std::cout << "0 - automatycznie): ";
+                std::cin >> representation;
+                if(representation == 0) {
+                    // Silnik (algorytm tego samego problemu i reprezentacja) wg modelu kosztu
+                    CostModel model;
+                    model.load(COST_MODEL_FILE);
+                    EngineChoice choice = chooseEngine(model, *graph, algorithm->shortest_paths);
+                    if(!choice.algorithm) {
+                        std::cout << "Zaden algorytm nie obsluguje tego grafu!" << std::endl;
+                        break;
+                    }
+                    std::cout << "Wybrano: " << choice.algorithm->title << ", reprezentacja "
+                              << representationName(choice.representation) << std::endl;
+                    if(!acceptsGraph(*choice.algorithm, *graph)) break;
+                    choice.algorithm->run(*graph, choice.representation);
+                    break;
+                }
+                if(representation < 1 || representation > REP_COUNT ||
+                   !(algorithm->representations & (1 << (representation - 1)))) {
+                    std::cout << "Nieprawidlowa opcja!" << std::endl;
+                    break;
+                }
+                if(!acceptsGraph(*algorithm, *graph)) break;
+                algorithm->run(*graph, representation - 1);
+                break;
+            }
+            case 5: {
+                const AlgorithmInfo* algorithm;
+                if(!chooseAlgorithm(true, algorithm)) break;
+                std::cout << "Uwaga: Testy wydajnosci moga potrwac kilka minut..." << std::endl;
+                if(askYesNo("Czy kontynuowac?")) {
+                    BenchmarkOptions options;
+                    options.collect_counters = askYesNo("Zbierac sprzetowe liczniki wydajnosci (Linux perf)?");
+                    options.verify = askYesNo("Sprawdzac zgodnosc wynikow wszystkich wariantow?");
+                    options.sweep = askYesNo("Przeglad skalowania (rozmiary 50-800, dopasowanie modeli zlozonosci)?");
+                    options.adaptive = askYesNo("Liczba instancji wg przedzialu ufnosci mediany (zamiast stalej)?");
+                    if(options.adaptive) {
+                        std::cout << "Docelowy 95% CI mediany (+-%): ";
+                        std::cin >> options.target_ci;
+                        options.target_ci /= 100.0;
+                        std::cout << "Budzet czasu na zestaw (s): ";
+                        std::cin >> options.time_budget;
+                    }
+                    std::cout << "Liczba watkow pomiarowych (1 - szeregowo, 0 - wszystkie rdzenie): ";
+                    std::cin >> options.workers;
+                    if(options.workers == 1) {
+                        options.generate_ahead = askYesNo("Generowac kolejna instancje w tle podczas pomiaru (krotszy czas testow)?");
+                    } else {
+                        options.pin_workers = askYesNo("Przypiac watki pomiarowe do rdzeni?");
+                        options.reserve_core = askYesNo("Zostawic pierwszy rdzen dla systemu?");
+                    }
+                    
+                    performPerformanceTests(algorithm, options);
+                }
+                break;
+            }
+            case 6: {
+                if(graph) {
+                    graph->reorderVertices();
+                } else {
+                    std::cout << "Brak grafu! Wczytaj lub wygeneruj graf." << std::endl;
+                }
+                break;
+            }
+            case 7: {
+                const AlgorithmInfo* algorithm;
+                if(!chooseAlgorithm(false, algorithm)) break;
+                if(!graph) graph = new Graph(10, false);
+                reorderingBenchmark(*graph, *algorithm);
+                break;
+            }
+            case 8: {
+                const AlgorithmInfo* algorithm;
+                if(!chooseAlgorithm(true, algorithm)) break;
+                if(!graph) graph = new Graph(10, false);
+                runVerification(*graph, algorithm);
+                break;
+            }
+            case 9: {
+                if(!graph) {
+                    std::cout << "Brak grafu! Wczytaj lub wygeneruj graf." << std::endl;
+                    break;
+                }
+                const AlgorithmInfo* algorithm;
+                if(!chooseAlgorithm(false, algorithm) || !acceptsGraph(*algorithm, *graph)) break;
+                if(algorithm->menu) {
+                    algorithm->menu(*graph);
+                } else {
+                    std::cout << "Brak opcji dodatkowych dla tego algorytmu." << std::endl;
+                }
+                break;
+            }
+            case 0:
+                std::cout << "Koniec programu." << std::endl;
+                break;
+            default:
+                std::cout << "Nieprawidlowa opcja!" << std::endl;
+        }
+    } while(choice != 0);
+    
+    if(graph) delete graph;
+    return 0;
+}